@@ -58,11 +58,12 @@ void usage_fprint(
 	fprintf( stream, "Use agdbinfo to determine information about a Windows\n"
 	                 "SuperFetch database file.\n\n" );
 
-	fprintf( stream, "Usage: agdbinfo [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: agdbinfo [ -hsvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-s:     print statistics about reading the file\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -123,6 +124,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *source = NULL;
 	char *program              = "agdbinfo";
 	system_integer_t option    = 0;
+	int print_statistics       = 0;
 	int verbose                = 0;
 
 	libcnotify_stream_set(
@@ -158,7 +160,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = agdbtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "hsvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -180,6 +182,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 's':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -245,6 +252,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     agdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     agdbinfo_info_handle,
 	     &error ) != 0 )
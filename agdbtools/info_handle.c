@@ -937,3 +937,136 @@ on_error:
 	return( -1 );
 }
 
+
+/* Prints the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libagdb_statistics_t statistics;
+
+	static char *function = "info_handle_statistics_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_file_get_statistics(
+	     info_handle->input_file,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tOpen time\t\t\t: %" PRIu64 " ns\n",
+	 statistics.open_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tIndex build time\t\t: %" PRIu64 " ns\n",
+	 statistics.index_build_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of compressed blocks\t: %" PRIu64 "\n",
+	 statistics.number_of_compressed_blocks );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of file reads\t\t: %" PRIu64 "\n",
+	 statistics.number_of_file_reads );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tFile read size\t\t\t: %" PRIu64 " bytes\n",
+	 statistics.file_read_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tFile read time\t\t\t: %" PRIu64 " ns\n",
+	 statistics.file_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of decompressed blocks\t: %" PRIu64 "\n",
+	 statistics.number_of_decompressed_blocks );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecompressed size\t\t: %" PRIu64 " bytes\n",
+	 statistics.decompressed_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecompression time\t\t: %" PRIu64 " ns\n",
+	 statistics.decompression_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of cache hits\t\t: %" PRIu64 "\n",
+	 statistics.number_of_cache_hits );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of cache misses\t\t: %" PRIu64 "\n",
+	 statistics.number_of_cache_misses );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of stream reads\t\t: %" PRIu64 "\n",
+	 statistics.number_of_stream_reads );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tStream read size\t\t: %" PRIu64 " bytes\n",
+	 statistics.stream_read_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of parsed records\t: %" PRIu64 "\n",
+	 statistics.number_of_parsed_records );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tParse time\t\t\t: %" PRIu64 " ns\n",
+	 statistics.parse_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of hash calculations\t: %" PRIu64 "\n",
+	 statistics.number_of_hash_calculations );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tHashed size\t\t\t: %" PRIu64 " bytes\n",
+	 statistics.hashed_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -87,6 +87,10 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
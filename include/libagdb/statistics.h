@@ -0,0 +1,112 @@
+/*
+ * The statistics definitions for libagdb
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_STATISTICS_H )
+#define _LIBAGDB_STATISTICS_H
+
+#include <libagdb/types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The statistics of an open file
+ * The times are in nanoseconds of a monotonic clock
+ */
+typedef struct libagdb_statistics libagdb_statistics_t;
+
+struct libagdb_statistics
+{
+	/* The time spent to open the file
+	 */
+	uint64_t open_time;
+
+	/* The time spent to build the compressed block index
+	 */
+	uint64_t index_build_time;
+
+	/* The number of compressed blocks
+	 */
+	uint64_t number_of_compressed_blocks;
+
+	/* The number of read operations on the file
+	 */
+	uint64_t number_of_file_reads;
+
+	/* The number of bytes read from the file
+	 */
+	uint64_t file_read_size;
+
+	/* The time spent reading from the file
+	 */
+	uint64_t file_read_time;
+
+	/* The number of decompressed blocks
+	 */
+	uint64_t number_of_decompressed_blocks;
+
+	/* The number of bytes produced by decompression
+	 */
+	uint64_t decompressed_size;
+
+	/* The time spent decompressing
+	 */
+	uint64_t decompression_time;
+
+	/* The number of compressed block lookups that were served from the cache
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of compressed block lookups that required the block to be read
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The number of reads from the uncompressed data stream
+	 */
+	uint64_t number_of_stream_reads;
+
+	/* The number of bytes read from the uncompressed data stream
+	 */
+	uint64_t stream_read_size;
+
+	/* The number of parsed volume, file and source information records
+	 */
+	uint64_t number_of_parsed_records;
+
+	/* The time spent parsing records, excluding file reads and decompression
+	 */
+	uint64_t parse_time;
+
+	/* The number of calculated path hashes
+	 */
+	uint64_t number_of_hash_calculations;
+
+	/* The number of bytes of which path hashes were calculated
+	 */
+	uint64_t hashed_size;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_STATISTICS_H ) */
+
@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_pool.h"
 #include "libagdb_definitions.h"
 #include "libagdb_file.h"
 #include "libagdb_io_handle.h"
@@ -33,6 +34,7 @@
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libfwnt.h"
+#include "libagdb_statistics.h"
 #include "libagdb_unused.h"
 
 /* Creates compressed block
@@ -138,6 +140,7 @@ on_error:
 }
 
 /* Frees compressed block
+ * A compressed block that is part of a pool is released back into the pool
  * Returns 1 if successful or -1 on error
  */
 int libagdb_compressed_block_free(
@@ -159,6 +162,26 @@ int libagdb_compressed_block_free(
 	}
 	if( *compressed_block != NULL )
 	{
+		if( ( *compressed_block )->pool != NULL )
+		{
+			if( libagdb_compressed_block_pool_release_block(
+			     ( *compressed_block )->pool,
+			     *compressed_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release compressed block.",
+				 function );
+
+				return( -1 );
+			}
+			*compressed_block = NULL;
+
+			return( 1 );
+		}
 		if( ( *compressed_block )->data != NULL )
 		{
 			memory_free(
@@ -172,6 +195,65 @@ int libagdb_compressed_block_free(
 	return( 1 );
 }
 
+/* Decompresses the data of a compressed block
+ * The Windows 8 MAM compressed data is a single stream, which is decoded by the MAM stream
+ * and is not supported here
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_decompress(
+     uint8_t file_type,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_decompress";
+	int result            = 0;
+
+	if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	{
+		result = libfwnt_lznt1_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          error );
+	}
+	else if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
+	{
+		result = libfwnt_lzxpress_huffman_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads a compressed block
  * Returns 1 if successful or -1 on error
  */
@@ -186,7 +268,7 @@ int libagdb_compressed_block_read(
 	uint8_t *compressed_data = NULL;
         static char *function    = "libagdb_compressed_block_read";
 	ssize_t read_count       = 0;
-	int result               = 0;
+	uint64_t timestamp       = 0;
 
 	if( compressed_block == NULL )
 	{
@@ -211,21 +293,58 @@ int libagdb_compressed_block_read(
 
 		return( -1 );
 	}
-	compressed_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * compressed_block_size );
-
-	if( compressed_data == NULL )
+	if( libagdb_io_handle_check_abort(
+	     io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to read compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 compressed_block_offset,
+		 compressed_block_offset );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( compressed_block->pool != NULL )
+	{
+		if( libagdb_compressed_block_pool_get_compressed_data(
+		     compressed_block->pool,
+		     compressed_block_size,
+		     &compressed_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed data from pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * compressed_block_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libagdb_statistics_read_buffer_at_offset(
+		      &( io_handle->statistics ),
 		      file_io_handle,
 		      compressed_data,
 		      compressed_block_size,
@@ -245,34 +364,15 @@ int libagdb_compressed_block_read(
 
 		goto on_error;
 	}
-	if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
-	{
-		result = libfwnt_lznt1_decompress(
-		          compressed_data,
-		          (size_t) compressed_block_size,
-		          compressed_block->data,
-		          &( compressed_block->data_size ),
-		          error );
-	}
-	else if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
-	{
-		result = libfwnt_lzxpress_huffman_decompress(
-		          compressed_data,
-		          (size_t) compressed_block_size,
-		          compressed_block->data,
-		          &( compressed_block->data_size ),
-		          error );
-	}
-	else if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 )
-	{
-		result = libfwnt_lzxpress_huffman_decompress(
-		          compressed_data,
-		          (size_t) compressed_block_size,
-		          compressed_block->data,
-		          &( compressed_block->data_size ),
-		          error );
-	}
-	if( result != 1 )
+	timestamp = libagdb_statistics_get_timestamp();
+
+	if( libagdb_compressed_block_decompress(
+	     io_handle->file_type,
+	     compressed_data,
+	     compressed_block_size,
+	     compressed_block->data,
+	     &( compressed_block->data_size ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -283,15 +383,19 @@ int libagdb_compressed_block_read(
 
 		goto on_error;
 	}
-	memory_free(
-	 compressed_data );
-
-	compressed_data = NULL;
-
+	io_handle->statistics.decompression_time            += libagdb_statistics_get_timestamp() - timestamp;
+	io_handle->statistics.number_of_decompressed_blocks += 1;
+	io_handle->statistics.decompressed_size             += compressed_block->data_size;
+	if( compressed_block->pool == NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
 	return( 1 );
 
 on_error:
-	if( compressed_data != NULL )
+	if( ( compressed_block->pool == NULL )
+	 && ( compressed_data != NULL ) )
 	{
 		memory_free(
 		 compressed_data );
@@ -394,10 +498,22 @@ int libagdb_compressed_block_read_element_data(
 
 		return( -1 );
 	}
-	if( libagdb_compressed_block_initialize(
-	     &compressed_block,
-	     (size_t) uncompressed_size,
-	     error ) != 1 )
+	if( io_handle->compressed_block_pool != NULL )
+	{
+		result = libagdb_compressed_block_pool_get_block(
+		          io_handle->compressed_block_pool,
+		          (size_t) uncompressed_size,
+		          &compressed_block,
+		          error );
+	}
+	else
+	{
+		result = libagdb_compressed_block_initialize(
+		          &compressed_block,
+		          (size_t) uncompressed_size,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
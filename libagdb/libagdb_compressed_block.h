@@ -45,6 +45,11 @@ struct libagdb_compressed_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The compressed block pool the block is part of
+	 * NULL if the block was allocated separately
+	 */
+	struct libagdb_compressed_block_pool *pool;
 };
 
 int libagdb_compressed_block_initialize(
@@ -56,6 +61,14 @@ int libagdb_compressed_block_free(
      libagdb_compressed_block_t **compressed_block,
      libcerror_error_t **error );
 
+int libagdb_compressed_block_decompress(
+     uint8_t file_type,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int libagdb_compressed_block_read(
      libagdb_compressed_block_t *compressed_block,
      libagdb_io_handle_t *io_handle,
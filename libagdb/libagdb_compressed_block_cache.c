@@ -0,0 +1,741 @@
+/*
+ * Compressed block cache functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_pool.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+
+/* Creates a compressed block cache
+ * Make sure the value compressed_block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_cache_initialize(
+     libagdb_compressed_block_cache_t **compressed_block_cache,
+     int number_of_blocks,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_cache_initialize";
+	int block_index       = 0;
+
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks <= 0 )
+	 || ( (size_t) number_of_blocks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( (size_t) maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_block_cache = memory_allocate_structure(
+	                           libagdb_compressed_block_cache_t );
+
+	if( *compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressed_block_cache,
+	     0,
+	     sizeof( libagdb_compressed_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed block cache.",
+		 function );
+
+		memory_free(
+		 *compressed_block_cache );
+
+		*compressed_block_cache = NULL;
+
+		return( -1 );
+	}
+	( *compressed_block_cache )->blocks = (libagdb_compressed_block_t **) memory_allocate(
+	                                                                       sizeof( libagdb_compressed_block_t * ) * maximum_number_of_entries );
+
+	if( ( *compressed_block_cache )->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_block_cache )->block_indexes = (int *) memory_allocate(
+	                                                      sizeof( int ) * maximum_number_of_entries );
+
+	if( ( *compressed_block_cache )->block_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_block_cache )->access_times = (int64_t *) memory_allocate(
+	                                                         sizeof( int64_t ) * maximum_number_of_entries );
+
+	if( ( *compressed_block_cache )->access_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access times.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_block_cache )->entry_indexes = (int *) memory_allocate(
+	                                                      sizeof( int ) * number_of_blocks );
+
+	if( ( *compressed_block_cache )->entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		( *compressed_block_cache )->entry_indexes[ block_index ] = -1;
+	}
+	( *compressed_block_cache )->number_of_blocks          = number_of_blocks;
+	( *compressed_block_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *compressed_block_cache != NULL )
+	{
+		if( ( *compressed_block_cache )->access_times != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_cache )->access_times );
+		}
+		if( ( *compressed_block_cache )->block_indexes != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_cache )->block_indexes );
+		}
+		if( ( *compressed_block_cache )->blocks != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_cache )->blocks );
+		}
+		memory_free(
+		 *compressed_block_cache );
+
+		*compressed_block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressed block cache
+ * The cached compressed blocks are freed or released to their pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_cache_free(
+     libagdb_compressed_block_cache_t **compressed_block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < ( *compressed_block_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( libagdb_compressed_block_free(
+			     &( ( *compressed_block_cache )->blocks[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed block of cache entry: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *compressed_block_cache )->entry_indexes );
+
+		memory_free(
+		 ( *compressed_block_cache )->access_times );
+
+		memory_free(
+		 ( *compressed_block_cache )->block_indexes );
+
+		memory_free(
+		 ( *compressed_block_cache )->blocks );
+
+		memory_free(
+		 *compressed_block_cache );
+
+		*compressed_block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a cached compressed block
+ * The compressed block remains managed by the cache
+ * Returns 1 if successful, 0 if the block is not cached or -1 on error
+ */
+int libagdb_compressed_block_cache_get_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_cache_get_block";
+	int entry_index       = 0;
+
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= compressed_block_cache->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = compressed_block_cache->entry_indexes[ block_index ];
+
+	if( entry_index < 0 )
+	{
+		return( 0 );
+	}
+	compressed_block_cache->current_access_time += 1;
+
+	compressed_block_cache->access_times[ entry_index ] = compressed_block_cache->current_access_time;
+
+	*compressed_block = compressed_block_cache->blocks[ entry_index ];
+
+	return( 1 );
+}
+
+/* Sets a compressed block in the cache
+ * If the cache is full the least recently used compressed block is evicted
+ * The cache takes over management of the compressed block
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_cache_set_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t *compressed_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_cache_set_block";
+	int entry_index       = 0;
+	int lookup_index      = 0;
+
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= compressed_block_cache->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_cache->entry_indexes[ block_index ] >= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed block cache - block: %d already cached.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( compressed_block_cache->number_of_entries < compressed_block_cache->maximum_number_of_entries )
+	{
+		entry_index = compressed_block_cache->number_of_entries;
+
+		compressed_block_cache->number_of_entries += 1;
+	}
+	else
+	{
+		for( lookup_index = 1;
+		     lookup_index < compressed_block_cache->number_of_entries;
+		     lookup_index++ )
+		{
+			if( compressed_block_cache->access_times[ lookup_index ] < compressed_block_cache->access_times[ entry_index ] )
+			{
+				entry_index = lookup_index;
+			}
+		}
+		if( libagdb_compressed_block_free(
+		     &( compressed_block_cache->blocks[ entry_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block of cache entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		compressed_block_cache->entry_indexes[ compressed_block_cache->block_indexes[ entry_index ] ] = -1;
+	}
+	compressed_block_cache->current_access_time += 1;
+
+	compressed_block_cache->blocks[ entry_index ]        = compressed_block;
+	compressed_block_cache->block_indexes[ entry_index ] = block_index;
+	compressed_block_cache->access_times[ entry_index ]  = compressed_block_cache->current_access_time;
+	compressed_block_cache->entry_indexes[ block_index ] = entry_index;
+
+	return( 1 );
+}
+
+/* Removes a compressed block from the cache
+ * The caller takes over management of the compressed block
+ * Returns 1 if successful, 0 if the block is not cached or -1 on error
+ */
+int libagdb_compressed_block_cache_remove_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_cache_remove_block";
+	int entry_index       = 0;
+	int last_entry_index  = 0;
+
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= compressed_block_cache->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = compressed_block_cache->entry_indexes[ block_index ];
+
+	if( entry_index < 0 )
+	{
+		return( 0 );
+	}
+	*compressed_block = compressed_block_cache->blocks[ entry_index ];
+
+	compressed_block_cache->entry_indexes[ block_index ] = -1;
+
+	/* Move the last cache entry into the entry of the removed block
+	 */
+	last_entry_index = compressed_block_cache->number_of_entries - 1;
+
+	if( entry_index != last_entry_index )
+	{
+		compressed_block_cache->blocks[ entry_index ]        = compressed_block_cache->blocks[ last_entry_index ];
+		compressed_block_cache->block_indexes[ entry_index ] = compressed_block_cache->block_indexes[ last_entry_index ];
+		compressed_block_cache->access_times[ entry_index ]  = compressed_block_cache->access_times[ last_entry_index ];
+
+		compressed_block_cache->entry_indexes[ compressed_block_cache->block_indexes[ entry_index ] ] = entry_index;
+	}
+	compressed_block_cache->blocks[ last_entry_index ] = NULL;
+
+	compressed_block_cache->number_of_entries -= 1;
+
+	return( 1 );
+}
+
+/* Retrieves a compressed block from the cache or reads it if not cached
+ * The compressed block remains managed by the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_cache_read_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_t *read_block   = NULL;
+	libfdata_list_element_t *list_element    = NULL;
+	static char *function                    = "libagdb_compressed_block_cache_read_block";
+	size64_t compressed_block_size           = 0;
+	size64_t uncompressed_size               = 0;
+	off64_t compressed_block_offset          = 0;
+	uint32_t compressed_block_flags          = 0;
+	int compressed_block_file_index          = 0;
+	int result                               = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          block_index,
+	          compressed_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block: %d from cache.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		io_handle->statistics.number_of_cache_hits += 1;
+
+		return( 1 );
+	}
+	io_handle->statistics.number_of_cache_misses += 1;
+
+	if( libfdata_list_get_element_by_index(
+	     compressed_blocks_list,
+	     block_index,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( libfdata_list_element_get_data_range(
+	     list_element,
+	     &compressed_block_file_index,
+	     &compressed_block_offset,
+	     &compressed_block_size,
+	     &compressed_block_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d data range.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( libfdata_list_element_get_mapped_size(
+	     list_element,
+	     &uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d mapped size.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( ( compressed_block_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: compressed block flags not set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_size > (size64_t) io_handle->uncompressed_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->compressed_block_pool != NULL )
+	{
+		result = libagdb_compressed_block_pool_get_block(
+		          io_handle->compressed_block_pool,
+		          (size_t) uncompressed_size,
+		          &read_block,
+		          error );
+	}
+	else
+	{
+		result = libagdb_compressed_block_initialize(
+		          &read_block,
+		          (size_t) uncompressed_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_compressed_block_read(
+	     read_block,
+	     io_handle,
+	     file_io_handle,
+	     compressed_block_offset,
+	     (size_t) compressed_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed block: %d.",
+		 function,
+		 block_index );
+
+		goto on_error;
+	}
+	if( libagdb_compressed_block_cache_set_block(
+	     compressed_block_cache,
+	     block_index,
+	     read_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed block: %d in cache.",
+		 function,
+		 block_index );
+
+		goto on_error;
+	}
+	*compressed_block = read_block;
+
+	return( 1 );
+
+on_error:
+	if( read_block != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &read_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,117 @@
+/*
+ * Compressed block cache functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_COMPRESSED_BLOCK_CACHE_H )
+#define _LIBAGDB_COMPRESSED_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_compressed_block_cache libagdb_compressed_block_cache_t;
+
+struct libagdb_compressed_block_cache
+{
+	/* The number of compressed blocks
+	 */
+	int number_of_blocks;
+
+	/* The maximum number of cache entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of cache entries
+	 */
+	int number_of_entries;
+
+	/* The compressed block of every cache entry
+	 */
+	libagdb_compressed_block_t **blocks;
+
+	/* The compressed block index of every cache entry
+	 */
+	int *block_indexes;
+
+	/* The last access time of every cache entry
+	 */
+	int64_t *access_times;
+
+	/* The cache entry index of every compressed block, -1 if not cached
+	 */
+	int *entry_indexes;
+
+	/* The current access time
+	 */
+	int64_t current_access_time;
+};
+
+int libagdb_compressed_block_cache_initialize(
+     libagdb_compressed_block_cache_t **compressed_block_cache,
+     int number_of_blocks,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_cache_free(
+     libagdb_compressed_block_cache_t **compressed_block_cache,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_cache_get_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_cache_set_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t *compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_cache_remove_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_cache_read_block(
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_COMPRESSED_BLOCK_CACHE_H ) */
+
@@ -0,0 +1,477 @@
+/*
+ * Compressed block pool functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_pool.h"
+#include "libagdb_libcerror.h"
+
+/* Creates a compressed block pool
+ * Make sure the value compressed_block_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_pool_initialize(
+     libagdb_compressed_block_pool_t **compressed_block_pool,
+     size_t block_data_size,
+     int number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_pool_initialize";
+	int block_index       = 0;
+
+	if( compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed block pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks <= 0 )
+	 || ( (size_t) number_of_blocks > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_compressed_block_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_data_size == 0 )
+	 || ( block_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / (size_t) number_of_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_block_pool = memory_allocate_structure(
+	                          libagdb_compressed_block_pool_t );
+
+	if( *compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed block pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressed_block_pool,
+	     0,
+	     sizeof( libagdb_compressed_block_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed block pool.",
+		 function );
+
+		memory_free(
+		 *compressed_block_pool );
+
+		*compressed_block_pool = NULL;
+
+		return( -1 );
+	}
+	( *compressed_block_pool )->blocks = (libagdb_compressed_block_t *) memory_allocate(
+	                                                                     sizeof( libagdb_compressed_block_t ) * number_of_blocks );
+
+	if( ( *compressed_block_pool )->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *compressed_block_pool )->blocks,
+	     0,
+	     sizeof( libagdb_compressed_block_t ) * number_of_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_block_pool )->blocks_data = (uint8_t *) memory_allocate(
+	                                                       sizeof( uint8_t ) * block_data_size * number_of_blocks );
+
+	if( ( *compressed_block_pool )->blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks data.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_block_pool )->free_blocks = (libagdb_compressed_block_t **) memory_allocate(
+	                                                                           sizeof( libagdb_compressed_block_t * ) * number_of_blocks );
+
+	if( ( *compressed_block_pool )->free_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free blocks.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		( *compressed_block_pool )->blocks[ block_index ].data      = &( ( ( *compressed_block_pool )->blocks_data )[ block_data_size * block_index ] );
+		( *compressed_block_pool )->blocks[ block_index ].data_size = block_data_size;
+		( *compressed_block_pool )->blocks[ block_index ].pool      = *compressed_block_pool;
+
+		( *compressed_block_pool )->free_blocks[ block_index ] = &( ( ( *compressed_block_pool )->blocks )[ block_index ] );
+	}
+	( *compressed_block_pool )->block_data_size       = block_data_size;
+	( *compressed_block_pool )->number_of_blocks      = number_of_blocks;
+	( *compressed_block_pool )->number_of_free_blocks = number_of_blocks;
+
+	return( 1 );
+
+on_error:
+	if( *compressed_block_pool != NULL )
+	{
+		if( ( *compressed_block_pool )->blocks_data != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_pool )->blocks_data );
+		}
+		if( ( *compressed_block_pool )->blocks != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_pool )->blocks );
+		}
+		memory_free(
+		 *compressed_block_pool );
+
+		*compressed_block_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressed block pool
+ * The blocks handed out by the pool must have been released before
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_pool_free(
+     libagdb_compressed_block_pool_t **compressed_block_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_pool_free";
+
+	if( compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block_pool != NULL )
+	{
+		if( ( *compressed_block_pool )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *compressed_block_pool )->compressed_data );
+		}
+		memory_free(
+		 ( *compressed_block_pool )->free_blocks );
+
+		memory_free(
+		 ( *compressed_block_pool )->blocks_data );
+
+		memory_free(
+		 ( *compressed_block_pool )->blocks );
+
+		memory_free(
+		 *compressed_block_pool );
+
+		*compressed_block_pool = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves a compressed block from the pool
+ * A separately allocated compressed block is returned when the pool has no free
+ * blocks or when the data size exceeds the block data size of the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_pool_get_block(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     size_t data_size,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_pool_get_block";
+
+	if( compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > compressed_block_pool->block_data_size )
+	 || ( compressed_block_pool->number_of_free_blocks <= 0 ) )
+	{
+		if( libagdb_compressed_block_initialize(
+		     compressed_block,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed block.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	compressed_block_pool->number_of_free_blocks -= 1;
+
+	*compressed_block = compressed_block_pool->free_blocks[ compressed_block_pool->number_of_free_blocks ];
+
+	( *compressed_block )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Releases a compressed block back into the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_pool_release_block(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     libagdb_compressed_block_t *compressed_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_pool_release_block";
+
+	if( compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block->pool != compressed_block_pool )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block - not part of pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_pool->number_of_free_blocks >= compressed_block_pool->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block pool - number of free blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_block_pool->free_blocks[ compressed_block_pool->number_of_free_blocks ] = compressed_block;
+
+	compressed_block_pool->number_of_free_blocks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a compressed data scratch buffer of at least the requested size
+ * The buffer is owned by the pool and reused between calls
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_pool_get_compressed_data(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libagdb_compressed_block_pool_get_compressed_data";
+
+	if( compressed_block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > compressed_block_pool->compressed_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            compressed_block_pool->compressed_data,
+		                            sizeof( uint8_t ) * compressed_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_block_pool->compressed_data      = reallocation;
+		compressed_block_pool->compressed_data_size = compressed_data_size;
+	}
+	*compressed_data = compressed_block_pool->compressed_data;
+
+	return( 1 );
+}
+
@@ -0,0 +1,104 @@
+/*
+ * Compressed block pool functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_COMPRESSED_BLOCK_POOL_H )
+#define _LIBAGDB_COMPRESSED_BLOCK_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_compressed_block_pool libagdb_compressed_block_pool_t;
+
+struct libagdb_compressed_block_pool
+{
+	/* The block data size
+	 */
+	size_t block_data_size;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The blocks
+	 */
+	libagdb_compressed_block_t *blocks;
+
+	/* The data of all the blocks in a contiguous buffer
+	 */
+	uint8_t *blocks_data;
+
+	/* The free blocks
+	 */
+	libagdb_compressed_block_t **free_blocks;
+
+	/* The number of free blocks
+	 */
+	int number_of_free_blocks;
+
+	/* The compressed data scratch buffer
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data scratch buffer size
+	 */
+	size_t compressed_data_size;
+};
+
+int libagdb_compressed_block_pool_initialize(
+     libagdb_compressed_block_pool_t **compressed_block_pool,
+     size_t block_data_size,
+     int number_of_blocks,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_pool_free(
+     libagdb_compressed_block_pool_t **compressed_block_pool,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_pool_get_block(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     size_t data_size,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_pool_release_block(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     libagdb_compressed_block_t *compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_pool_get_compressed_data(
+     libagdb_compressed_block_pool_t *compressed_block_pool,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_COMPRESSED_BLOCK_POOL_H ) */
+
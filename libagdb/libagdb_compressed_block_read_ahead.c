@@ -0,0 +1,1194 @@
+/*
+ * Compressed block read-ahead functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_pool.h"
+#include "libagdb_compressed_block_read_ahead.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
+#include "libagdb_libfdata.h"
+#include "libagdb_statistics.h"
+
+/* Creates a compressed block read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_initialize(
+     libagdb_compressed_block_read_ahead_t **read_ahead,
+     int number_of_blocks,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_read_ahead_initialize";
+	int job_index         = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_jobs <= 0 )
+	 || ( (size_t) number_of_jobs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_compressed_block_read_ahead_job_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libagdb_compressed_block_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libagdb_compressed_block_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->jobs = (libagdb_compressed_block_read_ahead_job_t *) memory_allocate(
+	                                                                       sizeof( libagdb_compressed_block_read_ahead_job_t ) * number_of_jobs );
+
+	if( ( *read_ahead )->jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *read_ahead )->jobs,
+	     0,
+	     sizeof( libagdb_compressed_block_read_ahead_job_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear jobs.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		( *read_ahead )->jobs[ job_index ].block_index = -1;
+	}
+	( *read_ahead )->number_of_blocks = number_of_blocks;
+	( *read_ahead )->number_of_jobs   = number_of_jobs;
+	( *read_ahead )->last_block_index = -1;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_ahead )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_ahead )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single thread decompresses the jobs in the order they are scheduled
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *read_ahead )->thread_pool ),
+	     NULL,
+	     1,
+	     number_of_jobs,
+	     (int (*)(intptr_t *, void *)) &libagdb_compressed_block_read_ahead_job_run,
+	     (void *) *read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( ( *read_ahead )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *read_ahead )->condition ),
+			 NULL );
+		}
+		if( ( *read_ahead )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *read_ahead )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *read_ahead )->jobs != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->jobs );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressed block read-ahead
+ * Waits for the scheduled jobs to complete, the compressed blocks that were not
+ * retrieved are freed or released to their pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_free(
+     libagdb_compressed_block_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_read_ahead_free";
+	int job_index         = 0;
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( ( *read_ahead )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *read_ahead )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( job_index = 0;
+		     job_index < ( *read_ahead )->number_of_jobs;
+		     job_index++ )
+		{
+			if( ( *read_ahead )->jobs[ job_index ].compressed_block != NULL )
+			{
+				if( libagdb_compressed_block_free(
+				     &( ( *read_ahead )->jobs[ job_index ].compressed_block ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free compressed block of job: %d.",
+					 function,
+					 job_index );
+
+					result = -1;
+				}
+			}
+			if( ( *read_ahead )->jobs[ job_index ].compressed_data != NULL )
+			{
+				memory_free(
+				 ( *read_ahead )->jobs[ job_index ].compressed_data );
+			}
+		}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( ( *read_ahead )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *read_ahead )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *read_ahead )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 ( *read_ahead )->jobs );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Runs a read-ahead job
+ * The result of the decompression is stored in the job, errors are not propagated
+ * Callback function for the read-ahead thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_job_run(
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libagdb_compressed_block_read_ahead_t *read_ahead )
+{
+	uint64_t timestamp = 0;
+	int result         = 1;
+
+	if( ( job == NULL )
+	 || ( job->compressed_block == NULL ) )
+	{
+		return( -1 );
+	}
+	timestamp = libagdb_statistics_get_timestamp();
+
+	job->result = libagdb_compressed_block_decompress(
+	               job->file_type,
+	               job->compressed_data,
+	               job->compressed_data_size,
+	               job->compressed_block->data,
+	               &( job->compressed_block->data_size ),
+	               NULL );
+
+	job->decompression_time = libagdb_statistics_get_timestamp() - timestamp;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( ( read_ahead != NULL )
+	 && ( read_ahead->mutex != NULL ) )
+	{
+		if( libcthreads_mutex_grab(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		job->is_completed = 1;
+
+		if( libcthreads_condition_broadcast(
+		     read_ahead->condition,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+		return( result );
+	}
+#endif
+	job->is_completed = 1;
+
+	return( result );
+}
+
+/* Waits for a read-ahead job to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_wait_for_job(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_read_ahead_wait_for_job";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( read_ahead->thread_pool != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     read_ahead->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		while( job->is_completed == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     read_ahead->condition,
+			     read_ahead->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     read_ahead->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+#endif
+	/* Without a thread pool the jobs are run when they are scheduled
+	 */
+	if( job->is_completed == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid job - not completed.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases a read-ahead job
+ * Waits for the job to complete and frees the compressed block if it was not retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_release_job(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_block_read_ahead_release_job";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->block_index < 0 )
+	{
+		return( 1 );
+	}
+	if( libagdb_compressed_block_read_ahead_wait_for_job(
+	     read_ahead,
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for job of block: %d.",
+		 function,
+		 job->block_index );
+
+		return( -1 );
+	}
+	if( job->compressed_block != NULL )
+	{
+		if( libagdb_compressed_block_free(
+		     &( job->compressed_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block: %d.",
+			 function,
+			 job->block_index );
+
+			return( -1 );
+		}
+	}
+	job->block_index  = -1;
+	job->is_completed = 0;
+
+	return( 1 );
+}
+
+/* Schedules a compressed block to be read ahead
+ * The compressed data is read by the calling thread, the decompression is done
+ * by the read-ahead thread. A job that is in use by another block is released first
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_schedule_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_read_ahead_job_t *job = NULL;
+	libfdata_list_element_t *list_element          = NULL;
+	uint8_t *reallocation                          = NULL;
+	static char *function                          = "libagdb_compressed_block_read_ahead_schedule_block";
+	size64_t compressed_block_size                 = 0;
+	size64_t uncompressed_size                     = 0;
+	ssize_t read_count                             = 0;
+	off64_t compressed_block_offset                = 0;
+	uint32_t compressed_block_flags                = 0;
+	int compressed_block_file_index                = 0;
+	int result                                     = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= read_ahead->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	job = &( read_ahead->jobs[ block_index % read_ahead->number_of_jobs ] );
+
+	if( job->block_index == block_index )
+	{
+		return( 1 );
+	}
+	if( libagdb_io_handle_check_abort(
+	     io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to schedule compressed block: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( libagdb_compressed_block_read_ahead_release_job(
+	     read_ahead,
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release job.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     compressed_blocks_list,
+	     block_index,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( libfdata_list_element_get_data_range(
+	     list_element,
+	     &compressed_block_file_index,
+	     &compressed_block_offset,
+	     &compressed_block_size,
+	     &compressed_block_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d data range.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( libfdata_list_element_get_mapped_size(
+	     list_element,
+	     &uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed blocks list element: %d mapped size.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( ( compressed_block_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: compressed block flags not set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_block_size == 0 )
+	 || ( compressed_block_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_size == 0 )
+	 || ( uncompressed_size > (size64_t) io_handle->uncompressed_block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) compressed_block_size > job->allocated_compressed_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            job->compressed_data,
+		                            sizeof( uint8_t ) * (size_t) compressed_block_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		job->compressed_data                = reallocation;
+		job->allocated_compressed_data_size = (size_t) compressed_block_size;
+	}
+	read_count = libagdb_statistics_read_buffer_at_offset(
+	              &( io_handle->statistics ),
+	              file_io_handle,
+	              job->compressed_data,
+	              (size_t) compressed_block_size,
+	              compressed_block_offset,
+	              error );
+
+	if( read_count != (ssize_t) compressed_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed block: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_index,
+		 compressed_block_offset,
+		 compressed_block_offset );
+
+		return( -1 );
+	}
+	if( io_handle->compressed_block_pool != NULL )
+	{
+		result = libagdb_compressed_block_pool_get_block(
+		          io_handle->compressed_block_pool,
+		          (size_t) uncompressed_size,
+		          &( job->compressed_block ),
+		          error );
+	}
+	else
+	{
+		result = libagdb_compressed_block_initialize(
+		          &( job->compressed_block ),
+		          (size_t) uncompressed_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	job->file_type            = io_handle->file_type;
+	job->compressed_data_size = (size_t) compressed_block_size;
+	job->is_completed         = 0;
+	job->result               = 0;
+	job->block_index          = block_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( read_ahead->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     read_ahead->thread_pool,
+		     (intptr_t *) job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push job of block: %d onto thread pool.",
+			 function,
+			 block_index );
+
+			libagdb_compressed_block_free(
+			 &( job->compressed_block ),
+			 NULL );
+
+			job->block_index = -1;
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	libagdb_compressed_block_read_ahead_job_run(
+	 job,
+	 read_ahead );
+
+	return( 1 );
+}
+
+/* Retrieves a compressed block that was read ahead
+ * Waits for the decompression of the block to complete, after which
+ * the caller takes over management of the compressed block
+ * Returns 1 if successful, 0 if the block was not read ahead or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_get_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_read_ahead_job_t *job = NULL;
+	static char *function                          = "libagdb_compressed_block_read_ahead_get_block";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= read_ahead->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	job = &( read_ahead->jobs[ block_index % read_ahead->number_of_jobs ] );
+
+	if( job->block_index != block_index )
+	{
+		return( 0 );
+	}
+	if( libagdb_compressed_block_read_ahead_wait_for_job(
+	     read_ahead,
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for job of block: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( job->result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress block: %d.",
+		 function,
+		 block_index );
+
+		libagdb_compressed_block_read_ahead_release_job(
+		 read_ahead,
+		 job,
+		 NULL );
+
+		return( -1 );
+	}
+	*compressed_block = job->compressed_block;
+
+	job->compressed_block = NULL;
+	job->block_index      = -1;
+	job->is_completed     = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a compressed block from the cache, the read-ahead or reads it
+ * When the block follows the previously read block, the blocks after it
+ * are scheduled to be read ahead
+ * The compressed block remains managed by the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_block_read_ahead_read_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_read_ahead_job_t *job = NULL;
+	libagdb_compressed_block_t *read_block         = NULL;
+	static char *function                          = "libagdb_compressed_block_read_ahead_read_block";
+	int last_block_index                           = 0;
+	int read_ahead_block_index                     = 0;
+	int result                                     = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= read_ahead->number_of_blocks )
+	 || ( block_index >= compressed_block_cache->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          block_index,
+	          compressed_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block: %d from cache.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		io_handle->statistics.number_of_cache_hits += 1;
+
+		return( 1 );
+	}
+	last_block_index = read_ahead->last_block_index;
+
+	read_ahead->last_block_index = block_index;
+
+	/* The job of the block is retrieved before the blocks after it are scheduled
+	 * since the last of the scheduled blocks uses the same job
+	 */
+	result = libagdb_compressed_block_read_ahead_get_block(
+	          read_ahead,
+	          block_index,
+	          &read_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block: %d from read-ahead.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The job is not reused until the blocks after the block are scheduled
+		 */
+		job = &( read_ahead->jobs[ block_index % read_ahead->number_of_jobs ] );
+
+		io_handle->statistics.number_of_cache_misses        += 1;
+		io_handle->statistics.number_of_decompressed_blocks += 1;
+		io_handle->statistics.decompressed_size             += read_block->data_size;
+		io_handle->statistics.decompression_time            += job->decompression_time;
+	}
+	if( block_index == ( last_block_index + 1 ) )
+	{
+		for( read_ahead_block_index = block_index + 1;
+		     read_ahead_block_index <= ( block_index + read_ahead->number_of_jobs );
+		     read_ahead_block_index++ )
+		{
+			if( read_ahead_block_index >= read_ahead->number_of_blocks )
+			{
+				break;
+			}
+			if( compressed_block_cache->entry_indexes[ read_ahead_block_index ] >= 0 )
+			{
+				continue;
+			}
+			if( libagdb_compressed_block_read_ahead_schedule_block(
+			     read_ahead,
+			     compressed_blocks_list,
+			     io_handle,
+			     file_io_handle,
+			     read_ahead_block_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to schedule compressed block: %d.",
+				 function,
+				 read_ahead_block_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( read_block == NULL )
+	{
+		if( libagdb_compressed_block_cache_read_block(
+		     compressed_block_cache,
+		     compressed_blocks_list,
+		     io_handle,
+		     file_io_handle,
+		     block_index,
+		     compressed_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libagdb_compressed_block_cache_set_block(
+	     compressed_block_cache,
+	     block_index,
+	     read_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed block: %d in cache.",
+		 function,
+		 block_index );
+
+		goto on_error;
+	}
+	*compressed_block = read_block;
+
+	return( 1 );
+
+on_error:
+	if( read_block != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &read_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,170 @@
+/*
+ * Compressed block read-ahead functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_COMPRESSED_BLOCK_READ_AHEAD_H )
+#define _LIBAGDB_COMPRESSED_BLOCK_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
+#include "libagdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_compressed_block_read_ahead_job libagdb_compressed_block_read_ahead_job_t;
+
+struct libagdb_compressed_block_read_ahead_job
+{
+	/* The compressed block index
+	 * -1 if the job is not in use
+	 */
+	int block_index;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The allocated compressed data size
+	 */
+	size_t allocated_compressed_data_size;
+
+	/* The compressed block the compressed data is decompressed into
+	 */
+	libagdb_compressed_block_t *compressed_block;
+
+	/* The time spent decompressing the compressed data in nanoseconds
+	 */
+	uint64_t decompression_time;
+
+	/* Value to indicate the job has completed
+	 */
+	uint8_t is_completed;
+
+	/* The result
+	 */
+	int result;
+};
+
+typedef struct libagdb_compressed_block_read_ahead libagdb_compressed_block_read_ahead_t;
+
+struct libagdb_compressed_block_read_ahead
+{
+	/* The number of compressed blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of jobs, which is the number of blocks that are read ahead
+	 */
+	int number_of_jobs;
+
+	/* The jobs, the job of a compressed block is at the block index modulo the number of jobs
+	 */
+	libagdb_compressed_block_read_ahead_job_t *jobs;
+
+	/* The index of the last compressed block that was read
+	 */
+	int last_block_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	/* The thread pool that decompresses the jobs
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the completed state of the jobs
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a job has completed
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libagdb_compressed_block_read_ahead_initialize(
+     libagdb_compressed_block_read_ahead_t **read_ahead,
+     int number_of_blocks,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_free(
+     libagdb_compressed_block_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_job_run(
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libagdb_compressed_block_read_ahead_t *read_ahead );
+
+int libagdb_compressed_block_read_ahead_wait_for_job(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_release_job(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_read_ahead_job_t *job,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_schedule_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_get_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+int libagdb_compressed_block_read_ahead_read_block(
+     libagdb_compressed_block_read_ahead_t *read_ahead,
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int block_index,
+     libagdb_compressed_block_t **compressed_block,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_COMPRESSED_BLOCK_READ_AHEAD_H ) */
+
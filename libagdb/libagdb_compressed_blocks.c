@@ -0,0 +1,566 @@
+/*
+ * Compressed blocks functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_blocks.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
+#include "libagdb_libfdata.h"
+#include "libagdb_statistics.h"
+
+/* Runs a decompress job
+ * The result of the decompression is stored in the job, errors are not propagated
+ * The job is skipped when the activity of the IO handle needs to be aborted
+ * Callback function for the decompression thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_blocks_decompress_job_run(
+     libagdb_compressed_blocks_decompress_job_t *job,
+     libagdb_io_handle_t *io_handle )
+{
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	if( libagdb_io_handle_check_abort(
+	     io_handle,
+	     NULL ) != 0 )
+	{
+		job->result = 0;
+
+		return( 1 );
+	}
+	job->result = libagdb_compressed_block_decompress(
+	               job->file_type,
+	               job->compressed_data,
+	               job->compressed_data_size,
+	               job->uncompressed_data,
+	               &( job->uncompressed_data_size ),
+	               NULL );
+
+	return( 1 );
+}
+
+/* Decompresses all the compressed blocks into a contiguous buffer
+ * The compressed data is taken from the file data if available, otherwise it is read
+ * in a single pass, after which the blocks are decompressed independently, using
+ * a thread pool if number_of_threads > 1 and multi-threading is supported,
+ * otherwise the blocks are decompressed by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_blocks_decompress(
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *file_data,
+     size_t file_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_blocks_decompress_job_t *jobs = NULL;
+	libfdata_list_element_t *list_element            = NULL;
+	uint8_t *compressed_data                         = NULL;
+	static char *function                            = "libagdb_compressed_blocks_decompress";
+	size64_t compressed_block_size                   = 0;
+	size64_t mapped_size                             = 0;
+	size_t uncompressed_data_offset                  = 0;
+	ssize_t read_count                               = 0;
+	off64_t compressed_block_offset                  = 0;
+	uint64_t timestamp                               = 0;
+	uint32_t compressed_block_flags                  = 0;
+	int compressed_block_file_index                  = 0;
+	int element_index                                = 0;
+	int number_of_elements                           = 0;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool           = NULL;
+	int batch_index                                  = 0;
+	int batch_size                                   = 0;
+	int number_of_batch_elements                     = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_size == 0 )
+	 || ( io_handle->file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     compressed_blocks_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of compressed blocks list elements.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_elements == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_elements < 0 )
+	 || ( (size_t) number_of_elements > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_compressed_blocks_decompress_job_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of compressed blocks list elements value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_data != NULL )
+	{
+		if( (size64_t) file_data_size < io_handle->file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * (size_t) io_handle->file_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_io_handle_check_abort(
+		     io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libagdb_statistics_read_buffer_at_offset(
+		              &( io_handle->statistics ),
+		              file_io_handle,
+		              compressed_data,
+		              (size_t) io_handle->file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		file_data = compressed_data;
+	}
+	jobs = (libagdb_compressed_blocks_decompress_job_t *) memory_allocate(
+	                                                       sizeof( libagdb_compressed_blocks_decompress_job_t ) * number_of_elements );
+
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decompress jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     jobs,
+	     0,
+	     sizeof( libagdb_compressed_blocks_decompress_job_t ) * number_of_elements ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decompress jobs.",
+		 function );
+
+		goto on_error;
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     compressed_blocks_list,
+		     element_index,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libfdata_list_element_get_data_range(
+		     list_element,
+		     &compressed_block_file_index,
+		     &compressed_block_offset,
+		     &compressed_block_size,
+		     &compressed_block_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d data range.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libfdata_list_element_get_mapped_size(
+		     list_element,
+		     &mapped_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d mapped size.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( ( compressed_block_offset < 0 )
+		 || ( (size64_t) compressed_block_offset >= io_handle->file_size )
+		 || ( compressed_block_size == 0 )
+		 || ( compressed_block_size > ( io_handle->file_size - (size64_t) compressed_block_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed block: %d range value out of bounds.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( mapped_size > (size64_t) ( uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed block: %d mapped size value out of bounds.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		jobs[ element_index ].file_type              = io_handle->file_type;
+		jobs[ element_index ].compressed_data        = &( file_data[ compressed_block_offset ] );
+		jobs[ element_index ].compressed_data_size   = (size_t) compressed_block_size;
+		jobs[ element_index ].uncompressed_data      = &( uncompressed_data[ uncompressed_data_offset ] );
+		jobs[ element_index ].uncompressed_data_size = (size_t) mapped_size;
+		jobs[ element_index ].mapped_size            = (size_t) mapped_size;
+
+		uncompressed_data_offset += (size_t) mapped_size;
+	}
+	timestamp = libagdb_statistics_get_timestamp();
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( number_of_threads > number_of_elements )
+		{
+			number_of_threads = number_of_elements;
+		}
+		/* The jobs are run in batches by a thread pool per batch, so that the progress
+		 * can be reported and the activity aborted by the calling thread in between
+		 */
+		batch_size = number_of_threads * LIBAGDB_COMPRESSED_BLOCKS_NUMBER_OF_JOBS_PER_THREAD;
+
+		for( batch_index = 0;
+		     batch_index < number_of_elements;
+		     batch_index += batch_size )
+		{
+			if( libagdb_io_handle_check_abort(
+			     io_handle,
+			     NULL ) != 0 )
+			{
+				break;
+			}
+			number_of_batch_elements = number_of_elements - batch_index;
+
+			if( number_of_batch_elements > batch_size )
+			{
+				number_of_batch_elements = batch_size;
+			}
+			if( libcthreads_thread_pool_create(
+			     &thread_pool,
+			     NULL,
+			     number_of_threads,
+			     number_of_batch_elements,
+			     (int (*)(intptr_t *, void *)) &libagdb_compressed_blocks_decompress_job_run,
+			     (void *) io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( element_index = batch_index;
+			     element_index < ( batch_index + number_of_batch_elements );
+			     element_index++ )
+			{
+				if( libcthreads_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( jobs[ element_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push decompress job: %d onto thread pool.",
+					 function,
+					 element_index );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( element_index = batch_index;
+			     element_index < ( batch_index + number_of_batch_elements );
+			     element_index++ )
+			{
+				io_handle->progress.uncompressed_offset += (uint64_t) jobs[ element_index ].uncompressed_data_size;
+			}
+			libagdb_io_handle_report_progress(
+			 io_handle );
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT ) */
+	{
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			libagdb_compressed_blocks_decompress_job_run(
+			 &( jobs[ element_index ] ),
+			 io_handle );
+
+			io_handle->progress.uncompressed_offset += (uint64_t) jobs[ element_index ].uncompressed_data_size;
+
+			libagdb_io_handle_report_progress(
+			 io_handle );
+		}
+	}
+	/* When multiple threads are used this is the elapsed time not the time spent by the threads
+	 */
+	io_handle->statistics.decompression_time += libagdb_statistics_get_timestamp() - timestamp;
+
+	if( libagdb_io_handle_check_abort(
+	     io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to decompress compressed blocks.",
+		 function );
+
+		goto on_error;
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( jobs[ element_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress block: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		/* A block that decompresses to less data would leave part of its uncompressed data unset
+		 */
+		if( jobs[ element_index ].uncompressed_data_size != jobs[ element_index ].mapped_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: mismatch in block: %d uncompressed data size: %" PRIzd " and mapped size: %" PRIzd ".",
+			 function,
+			 element_index,
+			 jobs[ element_index ].uncompressed_data_size,
+			 jobs[ element_index ].mapped_size );
+
+			goto on_error;
+		}
+		io_handle->statistics.number_of_decompressed_blocks += 1;
+		io_handle->statistics.decompressed_size             += jobs[ element_index ].uncompressed_data_size;
+	}
+	memory_free(
+	 jobs );
+
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
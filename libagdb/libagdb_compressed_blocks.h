@@ -0,0 +1,94 @@
+/*
+ * Compressed blocks functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_COMPRESSED_BLOCKS_H )
+#define _LIBAGDB_COMPRESSED_BLOCKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of decompress jobs per thread that are run before the progress is reported
+ */
+#define LIBAGDB_COMPRESSED_BLOCKS_NUMBER_OF_JOBS_PER_THREAD	16
+
+typedef struct libagdb_compressed_blocks_decompress_job libagdb_compressed_blocks_decompress_job_t;
+
+struct libagdb_compressed_blocks_decompress_job
+{
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The mapped size of the compressed block, which is the expected uncompressed data size
+	 */
+	size_t mapped_size;
+
+	/* The result
+	 */
+	int result;
+};
+
+int libagdb_compressed_blocks_decompress_job_run(
+     libagdb_compressed_blocks_decompress_job_t *job,
+     libagdb_io_handle_t *io_handle );
+
+int libagdb_compressed_blocks_decompress(
+     libfdata_list_t *compressed_blocks_list,
+     libagdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *file_data,
+     size_t file_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_COMPRESSED_BLOCKS_H ) */
+
@@ -22,20 +22,30 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_read_ahead.h"
 #include "libagdb_compressed_blocks_stream.h"
 #include "libagdb_compressed_blocks_stream_data_handle.h"
+#include "libagdb_io_handle.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
 
 /* Creates a compressed block stream
  * Make sure the value compressed_blocks_stream is referencing, is set to NULL
+ * The data handle of the stream is referenced by compressed_blocks_data_handle and freed with the stream
  * Returns 1 if successful or -1 on error
  */
 int libagdb_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
+     libagdb_compressed_blocks_stream_data_handle_t **compressed_blocks_data_handle,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libagdb_compressed_block_read_ahead_t *compressed_block_read_ahead,
+     libagdb_io_handle_t *io_handle,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
 	libagdb_compressed_blocks_stream_data_handle_t *data_handle = NULL;
@@ -57,6 +67,17 @@ int libagdb_compressed_blocks_stream_initialize(
 
 		return( -1 );
 	}
+	if( compressed_blocks_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed blocks data handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_blocks_list == NULL )
 	{
 		libcerror_error_set(
@@ -92,8 +113,13 @@ int libagdb_compressed_blocks_stream_initialize(
 
 		goto on_error;
 	}
-	data_handle->compressed_blocks_list  = compressed_blocks_list;
-	data_handle->compressed_blocks_cache = compressed_blocks_cache;
+	data_handle->compressed_blocks_list      = compressed_blocks_list;
+	data_handle->compressed_blocks_cache     = compressed_blocks_cache;
+	data_handle->compressed_block_cache      = compressed_block_cache;
+	data_handle->compressed_block_read_ahead = compressed_block_read_ahead;
+	data_handle->io_handle                   = io_handle;
+	data_handle->uncompressed_data           = uncompressed_data;
+	data_handle->uncompressed_data_size      = uncompressed_data_size;
 
 	if( libfdata_stream_initialize(
 	     compressed_blocks_stream,
@@ -177,6 +203,8 @@ int libagdb_compressed_blocks_stream_initialize(
 		}
 		segment_offset += segment_size;
 	}
+	*compressed_blocks_data_handle = data_handle;
+
 	return( 1 );
 
 on_error:
@@ -25,6 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_read_ahead.h"
+#include "libagdb_compressed_blocks_stream_data_handle.h"
+#include "libagdb_io_handle.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
@@ -35,8 +39,14 @@ extern "C" {
 
 int libagdb_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
+     libagdb_compressed_blocks_stream_data_handle_t **compressed_blocks_data_handle,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
+     libagdb_compressed_block_cache_t *compressed_block_cache,
+     libagdb_compressed_block_read_ahead_t *compressed_block_read_ahead,
+     libagdb_io_handle_t *io_handle,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
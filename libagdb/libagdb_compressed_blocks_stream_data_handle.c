@@ -24,7 +24,10 @@
 #include <types.h>
 
 #include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_read_ahead.h"
 #include "libagdb_compressed_blocks_stream_data_handle.h"
+#include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_unused.h"
@@ -130,8 +133,24 @@ int libagdb_compressed_blocks_stream_data_handle_free(
 	}
 	if( *data_handle != NULL )
 	{
-		/* The compressed_blocks_list and compressed_blocks_cache values are referenced and freed elsewhere
+		/* The compressed_blocks_list, compressed_blocks_cache, compressed_block_cache, compressed_block_read_ahead, io_handle and uncompressed_data values are referenced and freed elsewhere
 		 */
+		if( ( *data_handle )->pinned_block != NULL )
+		{
+			if( libagdb_compressed_block_free(
+			     &( ( *data_handle )->pinned_block ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pinned block.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *data_handle );
 
@@ -140,6 +159,209 @@ int libagdb_compressed_blocks_stream_data_handle_free(
 	return( result );
 }
 
+/* Retrieves the compressed block that contains a specific offset
+ * The compressed block remains managed by the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_blocks_stream_data_handle_get_compressed_block(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     int *block_index,
+     off64_t *block_data_offset,
+     libagdb_compressed_block_t **compressed_block,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libagdb_compressed_blocks_stream_data_handle_get_compressed_block";
+	uint64_t block_end_offset              = 0;
+	uint64_t number_of_decompressed_blocks = 0;
+	int result                             = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_block = NULL;
+
+	if( data_handle->compressed_block_cache != NULL )
+	{
+		if( libfdata_list_get_element_index_at_offset(
+		     data_handle->compressed_blocks_list,
+		     offset,
+		     block_index,
+		     block_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed block index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( data_handle->compressed_block_read_ahead != NULL )
+		{
+			result = libagdb_compressed_block_read_ahead_read_block(
+			          data_handle->compressed_block_read_ahead,
+			          data_handle->compressed_block_cache,
+			          data_handle->compressed_blocks_list,
+			          data_handle->io_handle,
+			          file_io_handle,
+			          *block_index,
+			          compressed_block,
+			          error );
+		}
+		else
+		{
+			result = libagdb_compressed_block_cache_read_block(
+			          data_handle->compressed_block_cache,
+			          data_handle->compressed_blocks_list,
+			          data_handle->io_handle,
+			          file_io_handle,
+			          *block_index,
+			          compressed_block,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed block: %d from cache.",
+			 function,
+			 *block_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( data_handle->io_handle != NULL )
+		{
+			number_of_decompressed_blocks = data_handle->io_handle->statistics.number_of_decompressed_blocks;
+		}
+		if( libfdata_list_get_element_value_at_offset(
+		     data_handle->compressed_blocks_list,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) data_handle->compressed_blocks_cache,
+		     offset,
+		     block_index,
+		     block_data_offset,
+		     (intptr_t **) compressed_block,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed block: %d from list.",
+			 function,
+			 *block_index );
+
+			return( -1 );
+		}
+		/* The compressed block was not read from the cache when it was decompressed
+		 */
+		if( data_handle->io_handle != NULL )
+		{
+			if( data_handle->io_handle->statistics.number_of_decompressed_blocks == number_of_decompressed_blocks )
+			{
+				data_handle->io_handle->statistics.number_of_cache_hits += 1;
+			}
+			else
+			{
+				data_handle->io_handle->statistics.number_of_cache_misses += 1;
+			}
+		}
+	}
+	if( *compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing compressed block: %d.",
+		 function,
+		 *block_index );
+
+		return( -1 );
+	}
+	if( ( *block_data_offset < 0 )
+	 || ( *block_data_offset >= (off64_t) ( *compressed_block )->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The progress is reported once for every compressed block that is read in sequence
+	 */
+	if( data_handle->io_handle != NULL )
+	{
+		block_end_offset = (uint64_t) ( offset - *block_data_offset ) + ( *compressed_block )->data_size;
+
+		if( block_end_offset != data_handle->io_handle->progress.uncompressed_offset )
+		{
+			data_handle->io_handle->progress.uncompressed_offset = block_end_offset;
+
+			libagdb_io_handle_report_progress(
+			 data_handle->io_handle );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the compressed block stream
  * Returns the number of bytes read or -1 on error
@@ -196,14 +418,51 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_at_offset(
-	     data_handle->compressed_blocks_list,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) data_handle->compressed_blocks_cache,
+	if( data_handle->uncompressed_data != NULL )
+	{
+		if( ( data_handle->current_offset < 0 )
+		 || ( data_handle->current_offset >= (off64_t) data_handle->uncompressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data handle - current offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) ( data_handle->uncompressed_data_size - (size_t) data_handle->current_offset );
+
+		if( (size_t) read_count > segment_data_size )
+		{
+			read_count = (ssize_t) segment_data_size;
+		}
+		if( memory_copy(
+		     segment_data,
+		     &( data_handle->uncompressed_data[ data_handle->current_offset ] ),
+		     (size_t) read_count ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->current_offset += read_count;
+
+		return( read_count );
+	}
+	if( libagdb_compressed_blocks_stream_data_handle_get_compressed_block(
+	     data_handle,
+	     (libbfio_handle_t *) file_io_handle,
 	     data_handle->current_offset,
 	     &segment_index,
 	     &segment_data_offset,
-	     (intptr_t **) &compressed_block,
+	     &compressed_block,
 	     read_flags,
 	     error ) != 1 )
 	{
@@ -211,61 +470,311 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve compressed block: %d from list.",
+		 "%s: unable to retrieve compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 segment_index );
+		 data_handle->current_offset,
+		 data_handle->current_offset );
 
 		return( -1 );
 	}
-	if( compressed_block == NULL )
+	if( (off64_t) ( segment_data_offset + segment_data_size ) > (off64_t) compressed_block->data_size )
+	{
+		read_count = (ssize_t) ( compressed_block->data_size - segment_data_offset );
+	}
+	else
+	{
+		read_count = (ssize_t) segment_data_size;
+	}
+	if( memory_copy(
+	     segment_data,
+	     &( compressed_block->data[ segment_data_offset ] ),
+	     (size_t) read_count ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed block data.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset += read_count;
+
+	return( read_count );
+}
+
+/* Retrieves a pointer to the uncompressed data at a specific offset
+ * The data is referenced, not copied, and is valid until the next read from the data handle
+ * The data size contains the number of bytes that remain in the compressed block
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_blocks_stream_data_handle_get_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "libagdb_compressed_blocks_stream_data_handle_get_data";
+	off64_t block_data_offset                    = 0;
+	int block_index                              = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->uncompressed_data != NULL )
+	{
+		if( ( offset < 0 )
+		 || ( offset >= (off64_t) data_handle->uncompressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*data      = &( data_handle->uncompressed_data[ offset ] );
+		*data_size = data_handle->uncompressed_data_size - (size_t) offset;
+
+		return( 1 );
+	}
+	if( libagdb_compressed_blocks_stream_data_handle_get_compressed_block(
+	     data_handle,
+	     file_io_handle,
+	     offset,
+	     &block_index,
+	     &block_data_offset,
+	     &compressed_block,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing compressed block: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 segment_index );
+		 offset,
+		 offset );
 
 		return( -1 );
 	}
-	if( ( segment_data_offset < 0 )
-	 || ( segment_data_offset >= (off64_t) compressed_block->data_size ) )
+	*data      = &( compressed_block->data[ block_data_offset ] );
+	*data_size = compressed_block->data_size - (size_t) block_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves a pointer to the uncompressed data at a specific offset and pins it
+ * The compressed block that contains the data is removed from the cache, so that
+ * the data remains valid until libagdb_compressed_blocks_stream_data_handle_unpin_data is called
+ * The data size contains the number of bytes that remain in the compressed block
+ * Returns 1 if successful, 0 if the data cannot be pinned or -1 on error
+ */
+int libagdb_compressed_blocks_stream_data_handle_pin_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "libagdb_compressed_blocks_stream_data_handle_pin_data";
+	off64_t block_data_offset                    = 0;
+	int block_index                              = 0;
+
+	if( data_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid segment data offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( (off64_t) ( segment_data_offset + segment_data_size ) > (off64_t) compressed_block->data_size )
+	if( data_handle->pinned_block != NULL )
 	{
-		read_count = (ssize_t) ( compressed_block->data_size - segment_data_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle - pinned block value already set.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( data == NULL )
 	{
-		read_count = (ssize_t) segment_data_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
 	}
-	if( memory_copy(
-	     segment_data,
-	     &( compressed_block->data[ segment_data_offset ] ),
-	     (size_t) read_count ) == NULL )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy compressed block data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	data_handle->current_offset += read_count;
+	if( data_handle->uncompressed_data != NULL )
+	{
+		/* The uncompressed data remains valid until the data handle is freed
+		 */
+		if( libagdb_compressed_blocks_stream_data_handle_get_data(
+		     data_handle,
+		     file_io_handle,
+		     offset,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The compressed blocks of the direct mapped cache cannot be removed from the cache
+	 */
+	if( data_handle->compressed_block_cache == NULL )
+	{
+		return( 0 );
+	}
+	if( libagdb_compressed_blocks_stream_data_handle_get_compressed_block(
+	     data_handle,
+	     file_io_handle,
+	     offset,
+	     &block_index,
+	     &block_data_offset,
+	     &compressed_block,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-	return( read_count );
+		return( -1 );
+	}
+	if( libagdb_compressed_block_cache_remove_block(
+	     data_handle->compressed_block_cache,
+	     block_index,
+	     &( data_handle->pinned_block ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove compressed block: %d from cache.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	*data      = &( data_handle->pinned_block->data[ block_data_offset ] );
+	*data_size = data_handle->pinned_block->data_size - (size_t) block_data_offset;
+
+	return( 1 );
+}
+
+/* Unpins the data pinned by libagdb_compressed_blocks_stream_data_handle_pin_data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compressed_blocks_stream_data_handle_unpin_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compressed_blocks_stream_data_handle_unpin_data";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->pinned_block != NULL )
+	{
+		if( libagdb_compressed_block_free(
+		     &( data_handle->pinned_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pinned block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
 /* Seeks a certain offset of the data
@@ -25,6 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_read_ahead.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
@@ -48,6 +53,33 @@ struct libagdb_compressed_blocks_stream_data_handle
 	/* The compressed blocks cache
 	 */
 	libfcache_cache_t *compressed_blocks_cache;
+
+	/* The compressed block cache, used instead of the compressed blocks cache
+	 * when a least recently used or pin all cache policy is set
+	 */
+	libagdb_compressed_block_cache_t *compressed_block_cache;
+
+	/* The compressed block read-ahead, used with the compressed block cache
+	 * to decompress the blocks that follow a sequentially read block in the background
+	 */
+	libagdb_compressed_block_read_ahead_t *compressed_block_read_ahead;
+
+	/* The IO handle
+	 */
+	libagdb_io_handle_t *io_handle;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The compressed block that was removed from the compressed block cache
+	 * to keep its data valid while it is referenced
+	 */
+	libagdb_compressed_block_t *pinned_block;
 };
 
 int libagdb_compressed_blocks_stream_data_handle_initialize(
@@ -58,6 +90,16 @@ int libagdb_compressed_blocks_stream_data_handle_free(
      libagdb_compressed_blocks_stream_data_handle_t **data_handle,
      libcerror_error_t **error );
 
+int libagdb_compressed_blocks_stream_data_handle_get_compressed_block(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     int *block_index,
+     off64_t *block_data_offset,
+     libagdb_compressed_block_t **compressed_block,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
          libagdb_compressed_blocks_stream_data_handle_t *data_handle,
          intptr_t *file_io_handle,
@@ -69,6 +111,26 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
          uint8_t read_flags,
          libcerror_error_t **error );
 
+int libagdb_compressed_blocks_stream_data_handle_get_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libagdb_compressed_blocks_stream_data_handle_pin_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libagdb_compressed_blocks_stream_data_handle_unpin_data(
+     libagdb_compressed_blocks_stream_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
 off64_t libagdb_compressed_blocks_stream_data_handle_seek_segment_offset(
          libagdb_compressed_blocks_stream_data_handle_t *data_handle,
          intptr_t *file_io_handle,
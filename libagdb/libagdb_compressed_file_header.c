@@ -285,6 +285,27 @@ int libagdb_compressed_file_header_read_data(
 			 function,
 			 compressed_file_header->uncompressed_data_size );
 		}
+#endif
+	}
+	else if( compressed_file_header->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 )
+	{
+		/* The lower 4 bits of the last signature byte contain the compression method, 4 represents LZXPRESS Huffman,
+		 * the upper bit is set since the signature is "MAM\x84", hence the uncompressed data size is followed
+		 * by a 32-bit checksum
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 compressed_file_header->uncompressed_data_size );
+
+		compressed_file_header->compressed_data_offset = 12;
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: uncompressed data size\t: %" PRIu32 "\n",
+			 function,
+			 compressed_file_header->uncompressed_data_size );
+		}
 #endif
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
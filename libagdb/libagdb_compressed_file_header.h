@@ -52,6 +52,10 @@ struct libagdb_compressed_file_header
 	/* The uncompressed data size
 	 */
 	uint32_t uncompressed_data_size;
+
+	/* The offset of the compressed data
+	 */
+	off64_t compressed_data_offset;
 };
 
 int libagdb_compressed_file_header_initialize(
@@ -26,19 +26,28 @@
 #include <wide_string.h>
 
 #include "libagdb_compressed_block.h"
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_pool.h"
+#include "libagdb_compressed_block_read_ahead.h"
+#include "libagdb_compressed_blocks.h"
 #include "libagdb_compressed_blocks_stream.h"
+#include "libagdb_compressed_blocks_stream_data_handle.h"
 #include "libagdb_compressed_file_header.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
 #include "libagdb_file.h"
+#include "libagdb_file_information.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcdata.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libcnotify.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_mam_stream.h"
+#include "libagdb_mapped_file.h"
 #include "libagdb_source_information.h"
+#include "libagdb_statistics.h"
 #include "libagdb_volume_information.h"
 
 /* Creates a file
@@ -146,6 +155,10 @@ int libagdb_file_initialize(
 
 		goto on_error;
 	}
+	internal_file->mam_checkpoint_interval         = LIBAGDB_DEFAULT_MAM_CHECKPOINT_INTERVAL;
+	internal_file->maximum_number_of_cache_entries = LIBAGDB_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS;
+	internal_file->cache_policy                    = LIBAGDB_CACHE_POLICY_DIRECT_MAPPED;
+
 	*file = (libagdb_file_t *) internal_file;
 
 	return( 1 );
@@ -265,6 +278,7 @@ int libagdb_file_free(
 }
 
 /* Signals the file to abort its current activity
+ * The abort also applies to the activities that follow, until the file is closed
  * Returns 1 if successful or -1 on error
  */
 int libagdb_file_signal_abort(
@@ -303,19 +317,21 @@ int libagdb_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
+/* Sets the number of threads used to decompress the compressed blocks
+ * A value of 0 represents the compressed blocks are decompressed on demand,
+ * otherwise all compressed blocks are decompressed when the file is opened
+ * Without multi-threading support the compressed blocks are decompressed by
+ * the calling thread for every value other than 0
+ * This function needs to be called before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open(
+int libagdb_file_set_number_of_decompression_threads(
      libagdb_file_t *file,
-     const char *filename,
-     int access_flags,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open";
-	size_t filename_length                 = 0;
+	static char *function                  = "libagdb_file_set_number_of_decompression_threads";
 
 	if( file == NULL )
 	{
@@ -330,132 +346,99 @@ int libagdb_file_open(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBAGDB_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file->number_of_decompression_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the MAM checkpoint interval
+ * The checkpoint interval is the minimum number of uncompressed bytes between
+ * checkpoints of the MAM decoder, a value of 0 disables checkpoints
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_mam_checkpoint_interval(
+     libagdb_file_t *file,
+     size_t checkpoint_interval,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_mam_checkpoint_interval";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
-	if( libagdb_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( checkpoint_interval > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid checkpoint interval value exceeds maximum.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->mam_checkpoint_interval = checkpoint_interval;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a file
+/* Sets the maximum number of compressed blocks cache entries
+ * This function needs to be called before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_wide(
+int libagdb_file_set_maximum_cache_entries(
      libagdb_file_t *file,
-     const wchar_t *filename,
-     int access_flags,
+     int maximum_cache_entries,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open_wide";
-	size_t filename_length                 = 0;
+	static char *function                  = "libagdb_file_set_maximum_cache_entries";
 
 	if( file == NULL )
 	{
@@ -470,132 +453,104 @@ int libagdb_file_open_wide(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( ( maximum_cache_entries <= 0 )
+	 || ( maximum_cache_entries > LIBAGDB_MAXIMUM_NUMBER_OF_CACHE_ENTRIES ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum cache entries value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file->maximum_number_of_cache_entries = maximum_cache_entries;
+
+	return( 1 );
+}
+
+/* Sets the compressed blocks cache policy
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_cache_policy(
+     libagdb_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_cache_policy";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
-	if( libagdb_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	if( ( cache_policy != LIBAGDB_CACHE_POLICY_DIRECT_MAPPED )
+	 && ( cache_policy != LIBAGDB_CACHE_POLICY_LEAST_RECENTLY_USED )
+	 && ( cache_policy != LIBAGDB_CACHE_POLICY_PIN_ALL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache policy.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->cache_policy = cache_policy;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif
-
-/* Opens a file using a Basic File IO (bfio) handle
+/* Sets the number of compressed blocks that are read ahead
+ * When the compressed blocks are read sequentially the blocks that follow the
+ * current block are decompressed in the background, a value of 0 disables read-ahead
+ * Read-ahead only applies when the compressed blocks are decompressed on demand,
+ * that is when the number of decompression threads is 0
+ * Without multi-threading support there is no read-ahead thread and the value is ignored
+ * This function needs to be called before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_file_io_handle(
+int libagdb_file_set_number_of_read_ahead_blocks(
      libagdb_file_t *file,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     int number_of_blocks,
      libcerror_error_t **error )
 {
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open_file_io_handle";
-	int bfio_access_flags                  = 0;
-	int file_io_handle_is_open             = 0;
+	static char *function                  = "libagdb_file_set_number_of_read_ahead_blocks";
 
 	if( file == NULL )
 	{
@@ -621,121 +576,179 @@ int libagdb_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( ( number_of_blocks < 0 )
+	 || ( number_of_blocks > LIBAGDB_MAXIMUM_NUMBER_OF_READ_AHEAD_BLOCKS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	internal_file->number_of_read_ahead_blocks = number_of_blocks;
+
+	return( 1 );
+}
+
+/* Sets the time budget
+ * The time budget is in milliseconds and applies to every open, scan and read of
+ * the volume, file and source information records. A value of 0 represents no time budget
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_time_budget(
+     libagdb_file_t *file,
+     uint64_t time_budget,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_time_budget";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( time_budget > ( (uint64_t) UINT64_MAX / 1000000 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time budget value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	internal_file->file_io_handle = file_io_handle;
-
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          internal_file->file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( file_io_handle_is_open == 0 )
+	internal_file->io_handle->time_budget = time_budget;
+
+	return( 1 );
+}
+
+/* Sets the progress callback
+ * The progress callback is invoked for every compressed block, or batch of compressed blocks
+ * when these are decompressed by multiple threads, and every record that is read,
+ * it returns 0 to continue or non-zero to abort, like libagdb_file_signal_abort does.
+ * A value of NULL represents no progress callback
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_progress_callback(
+     libagdb_file_t *file,
+     int (*progress_callback)(
+            const libagdb_progress_t *progress,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_progress_callback";
+
+	if( file == NULL )
 	{
-		if( libbfio_handle_open(
-		     internal_file->file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			goto on_error;
-		}
-		internal_file->file_io_handle_opened_in_library = 1;
+		return( -1 );
 	}
-	if( libagdb_file_open_read(
-	     internal_file,
-	     file_io_handle,
-	     error ) != 1 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle = file_io_handle;
+	internal_file->io_handle->progress_callback  = progress_callback;
+	internal_file->io_handle->progress_user_data = user_data;
 
 	return( 1 );
+}
 
-on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+/* Sets the hash verification
+ * When set the stored name hash of the 32-bit file information records is verified
+ * against the hash of the path, which is otherwise not calculated
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_verify_hashes(
+     libagdb_file_t *file,
+     uint8_t verify_hashes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_verify_hashes";
+
+	if( file == NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
+	internal_file = (libagdb_internal_file_t *) file;
 
-	return( -1 );
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->verify_hashes = verify_hashes;
+
+	return( 1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a file
+ * Returns 1 if successful or -1 on error
  */
-int libagdb_file_close(
+int libagdb_file_open(
      libagdb_file_t *file,
+     const char *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_close";
+	static char *function                  = "libagdb_file_open";
+	size_t filename_length                 = 0;
 	int result                             = 0;
 
 	if( file == NULL )
@@ -751,193 +764,221 @@ int libagdb_file_close(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libagdb_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* A file that is memory mapped is read from the mapped data, so that the file
+	 * is opened only once. If the file cannot be mapped it is read using a file IO handle
+	 */
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( internal_file->mapped_file != NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - mapped file value already set.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
+		if( libagdb_mapped_file_initialize(
+		     &( internal_file->mapped_file ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_file->file_io_handle_created_in_library = 0;
-	}
-	internal_file->file_io_handle = NULL;
+		result = libagdb_mapped_file_map(
+		          internal_file->mapped_file,
+		          filename,
+		          error );
 
-	if( libagdb_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
 
-		result = -1;
+			goto on_error;
+		}
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( result != 0 )
 	{
-		if( libfdata_list_free(
-		     &( internal_file->compressed_blocks_list ),
+		if( libbfio_memory_range_initialize(
+		     &file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks list.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		if( libfcache_cache_free(
-		     &( internal_file->compressed_blocks_cache ),
+		if( libbfio_memory_range_set(
+		     file_io_handle,
+		     internal_file->mapped_file->data,
+		     internal_file->mapped_file->data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks cache.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set memory range of file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-	if( internal_file->uncompressed_data_stream != NULL )
+	else
 	{
-		if( libfdata_stream_free(
-		     &( internal_file->uncompressed_data_stream ),
+		if( libbfio_file_initialize(
+		     &file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free uncompressed data strea,.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	if( libcdata_array_resize(
-	     internal_file->volumes_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize volumes array.",
-		 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libbfio_handle_set_track_offsets_read(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track offsets read in file IO handle.",
+			 function );
 
-		result = -1;
-	}
-	if( libcdata_array_resize(
-	     internal_file->sources_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+			goto on_error;
+		}
+#endif
+		filename_length = narrow_string_length(
+		                   filename );
+
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags & ~( LIBAGDB_ACCESS_FLAG_MEMORY_MAP ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize sources array.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
-		result = -1;
+		goto on_error;
 	}
-	return( result );
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( internal_file->mapped_file != NULL )
+	{
+		libagdb_mapped_file_free(
+		 &( internal_file->mapped_file ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_read(
-     libagdb_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libagdb_file_open_wide(
+     libagdb_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
-	uint8_t alignment_padding_data[ 8 ];
-
-	libagdb_compressed_file_header_t *compressed_file_header = NULL;
-	libagdb_source_information_t *source_information         = NULL;
-	libagdb_volume_information_t *volume_information         = NULL;
-	static char *function                                    = "libagdb_file_open_read";
-	ssize64_t read_count                                     = 0;
-	size_t alignment_padding_size                            = 0;
-	off64_t file_offset                                      = 0;
-	uint32_t number_of_sources                               = 0;
-	uint32_t number_of_volumes                               = 0;
-	uint32_t source_index                                    = 0;
-	uint32_t volume_index                                    = 0;
-	int entry_index                                          = 0;
-	int segment_index                                        = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_wide";
+	size_t filename_length                 = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -948,279 +989,3157 @@ int libagdb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks list value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_cache != NULL )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks cache value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
-	{
-		internal_file->io_handle->abort = 0;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_MEMORY_MAP ) != 0 )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory map access currently not supported.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libagdb_compressed_file_header_initialize(
-	     &compressed_file_header,
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed file header.",
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libagdb_compressed_file_header_read_file_io_handle(
-	     compressed_file_header,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed file header.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	internal_file->io_handle->file_type               = compressed_file_header->file_type;
-	internal_file->io_handle->file_size               = compressed_file_header->file_size;
-	internal_file->io_handle->uncompressed_block_size = compressed_file_header->uncompressed_block_size;
-	internal_file->io_handle->uncompressed_data_size  = compressed_file_header->uncompressed_data_size;
+	internal_file->file_io_handle_created_in_library = 1;
 
-	if( libagdb_compressed_file_header_free(
-	     &compressed_file_header,
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif
+
+/* Opens a file from data in memory
+ * The data is not copied and must remain available and unchanged until the file is closed
+ * For an uncompressed file the records are parsed from, and paths reference, the data directly
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_memory";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed file header.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( internal_file->io_handle->file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
 	{
-		if( libfdata_list_initialize(
-		     &( internal_file->compressed_blocks_list ),
-		     (intptr_t *) internal_file->io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks list.",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->memory_data      = data;
+	internal_file->memory_data_size = data_size;
+
+	/* The data is already in memory and is not read into memory a second time
+	 */
+	if( libagdb_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags & ~( LIBAGDB_ACCESS_FLAG_READ_INTO_MEMORY ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	internal_file->memory_data      = NULL;
+	internal_file->memory_data_size = 0;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_file_io_handle";
+	int bfio_access_flags                  = 0;
+	int file_io_handle_is_open             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory map access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	/* An abort that was signalled before the file was opened does not apply
+	 */
+	internal_file->io_handle->abort = 0;
+
+	if( libagdb_io_handle_start_activity(
+	     internal_file->io_handle,
+	     internal_file->io_handle->time_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start activity.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->file_io_handle = file_io_handle;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          internal_file->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->file_io_handle_opened_in_library = 1;
+	}
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_READ_INTO_MEMORY ) != 0 )
+	{
+		if( libagdb_internal_file_read_into_memory(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_file_open_read(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->deadline = 0;
+
+	return( 1 );
+
+on_error:
+	internal_file->io_handle->deadline = 0;
+
+	if( internal_file->source_file_io_handle != NULL )
+	{
+		libagdb_internal_file_close_file_data_io_handle(
+		 internal_file,
+		 NULL );
+	}
+	if( internal_file->file_data != NULL )
+	{
+		memory_free(
+		 internal_file->file_data );
+
+		internal_file->file_data = NULL;
+	}
+	internal_file->memory_data      = NULL;
+	internal_file->memory_data_size = 0;
+
+	if( ( file_io_handle_is_open == 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	return( -1 );
+}
+
+/* Reads the entire file into memory
+ * The file data is read with a single read, or the memory mapped file data is used
+ * if available. Afterwards the file IO handle refers to the file data in memory
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_read_into_memory(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_data_io_handle = NULL;
+	uint8_t *file_data                    = NULL;
+	static char *function                 = "libagdb_internal_file_read_into_memory";
+	size64_t file_size                    = 0;
+	ssize_t read_count                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->source_file_io_handle != NULL )
+	 || ( internal_file->file_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_file->mapped_file != NULL )
+	 && ( internal_file->mapped_file->data != NULL )
+	 && ( (size64_t) internal_file->mapped_file->data_size == file_size ) )
+	{
+		file_data = internal_file->mapped_file->data;
+	}
+	else
+	{
+		internal_file->file_data = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * (size_t) file_size );
+
+		if( internal_file->file_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_io_handle_check_abort(
+		     internal_file->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read file data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libagdb_statistics_read_buffer_at_offset(
+		              &( internal_file->io_handle->statistics ),
+		              internal_file->file_io_handle,
+		              internal_file->file_data,
+		              (size_t) file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data.",
+			 function );
+
+			goto on_error;
+		}
+		file_data = internal_file->file_data;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_data_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file data IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_data_io_handle,
+	     file_data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file data IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_data_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file data IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->source_file_io_handle = internal_file->file_io_handle;
+	internal_file->file_io_handle        = file_data_io_handle;
+	internal_file->memory_data           = file_data;
+	internal_file->memory_data_size      = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( file_data_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_data_io_handle,
+		 NULL );
+	}
+	if( internal_file->file_data != NULL )
+	{
+		memory_free(
+		 internal_file->file_data );
+
+		internal_file->file_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the file IO handle of the file data read into memory
+ * The file IO handle is restored to the file IO handle the file was opened with
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_close_file_data_io_handle(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_file_close_file_data_io_handle";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     internal_file->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file data IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_free(
+	     &( internal_file->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file data IO handle.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->file_io_handle        = internal_file->source_file_io_handle;
+	internal_file->source_file_io_handle = NULL;
+
+	return( result );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libagdb_file_close(
+     libagdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_close";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the file was read into memory the file IO handle refers to the file data
+	 * and is replaced by the file IO handle the file was opened with
+	 */
+	if( internal_file->source_file_io_handle != NULL )
+	{
+		if( libagdb_internal_file_close_file_data_io_handle(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file data IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libagdb_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	if( libagdb_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->compressed_blocks_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_block_read_ahead != NULL )
+	{
+		if( libagdb_compressed_block_read_ahead_free(
+		     &( internal_file->compressed_block_read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_block_cache != NULL )
+	{
+		if( libagdb_compressed_block_cache_free(
+		     &( internal_file->compressed_block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data strea,.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_block_pool != NULL )
+	{
+		if( libagdb_compressed_block_pool_free(
+		     &( internal_file->compressed_block_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_resize(
+	     internal_file->volumes_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volumes array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_resize(
+	     internal_file->sources_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sources array.",
+		 function );
+
+		result = -1;
+	}
+	/* The mapped file, file data and uncompressed data are freed after the volume
+	 * and source information that can reference their data
+	 */
+	if( internal_file->mapped_file != NULL )
+	{
+		if( libagdb_mapped_file_free(
+		     &( internal_file->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->file_data != NULL )
+	{
+		memory_free(
+		 internal_file->file_data );
+
+		internal_file->file_data = NULL;
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->uncompressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+	if( internal_file->peek_buffer != NULL )
+	{
+		memory_free(
+		 internal_file->peek_buffer );
+
+		internal_file->peek_buffer = NULL;
+	}
+	if( internal_file->source_hash_table != NULL )
+	{
+		memory_free(
+		 internal_file->source_hash_table );
+
+		internal_file->source_hash_table = NULL;
+	}
+	internal_file->peek_buffer_size           = 0;
+	internal_file->data_is_peeked             = 0;
+	internal_file->memory_data                = NULL;
+	internal_file->memory_data_size           = 0;
+	internal_file->first_record_offset        = 0;
+	internal_file->next_record_offset         = 0;
+	internal_file->number_of_read_volumes     = 0;
+	internal_file->number_of_read_sources     = 0;
+	internal_file->source_hash_table_size     = 0;
+	internal_file->source_hash_table_is_built = 0;
+
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_read(
+     libagdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_file_header_t *compressed_file_header = NULL;
+	static char *function                                    = "libagdb_file_open_read";
+	const uint8_t *file_data                                 = NULL;
+	size_t file_data_size                                    = 0;
+	off64_t compressed_data_offset                           = 0;
+	off64_t file_offset                                      = 0;
+	uint64_t index_build_timestamp                           = 0;
+	uint64_t timestamp                                       = 0;
+	uint32_t number_of_sources                               = 0;
+	uint32_t number_of_volumes                               = 0;
+	int number_of_cache_entries                              = 0;
+	int number_of_compressed_blocks                          = 0;
+	int number_of_read_ahead_blocks                          = 0;
+	int segment_index                                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_block_read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed block read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	timestamp = libagdb_statistics_get_timestamp();
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libagdb_compressed_file_header_initialize(
+	     &compressed_file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_compressed_file_header_read_file_io_handle(
+	     compressed_file_header,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_type               = compressed_file_header->file_type;
+	internal_file->io_handle->file_size               = compressed_file_header->file_size;
+	internal_file->io_handle->uncompressed_block_size = compressed_file_header->uncompressed_block_size;
+	internal_file->io_handle->uncompressed_data_size  = compressed_file_header->uncompressed_data_size;
+
+	compressed_data_offset = compressed_file_header->compressed_data_offset;
+
+	if( memory_set(
+	     &( internal_file->io_handle->progress ),
+	     0,
+	     sizeof( libagdb_progress_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear progress.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->progress.uncompressed_data_size = (uint64_t) internal_file->io_handle->uncompressed_data_size;
+
+	if( libagdb_compressed_file_header_free(
+	     &compressed_file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 )
+	{
+		/* The MAM compressed data is a single LZXPRESS Huffman stream in which matches
+		 * can reference data of previous chunks, hence it is decoded on demand
+		 */
+		if( (size64_t) compressed_data_offset >= internal_file->io_handle->file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed data offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_mam_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     compressed_data_offset,
+		     internal_file->io_handle->file_size - (size64_t) compressed_data_offset,
+		     (size_t) internal_file->io_handle->uncompressed_data_size,
+		     internal_file->mam_checkpoint_interval,
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create MAM stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( internal_file->io_handle->file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( libfdata_list_initialize(
+		     &( internal_file->compressed_blocks_list ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading compressed blocks:\n" );
+		}
+#endif
+		index_build_timestamp = libagdb_statistics_get_timestamp();
+
+		if( libagdb_io_handle_read_compressed_blocks(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     internal_file->compressed_blocks_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics.index_build_time += libagdb_statistics_get_timestamp() - index_build_timestamp;
+
+		if( libfdata_list_get_number_of_elements(
+		     internal_file->compressed_blocks_list,
+		     &number_of_compressed_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of compressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics.number_of_compressed_blocks = (uint64_t) number_of_compressed_blocks;
+
+		number_of_cache_entries = internal_file->maximum_number_of_cache_entries;
+
+		if( internal_file->cache_policy == LIBAGDB_CACHE_POLICY_PIN_ALL )
+		{
+			number_of_cache_entries = number_of_compressed_blocks;
+		}
+		/* When all the compressed blocks are decompressed on open every read is served
+		 * from the uncompressed data, hence no compressed block cache is needed
+		 */
+		if( internal_file->number_of_decompression_threads == 0 )
+		{
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+			/* Without multi-threading support there is no thread to decompress
+			 * the blocks in the background, hence read-ahead is disabled
+			 */
+			number_of_read_ahead_blocks = internal_file->number_of_read_ahead_blocks;
+#endif
+			/* Read-ahead requires the compressed block cache, which is therefore
+			 * also used when the direct mapped cache policy is set
+			 */
+			if( ( number_of_compressed_blocks == 0 )
+			 || ( ( internal_file->cache_policy == LIBAGDB_CACHE_POLICY_DIRECT_MAPPED )
+			  && ( number_of_read_ahead_blocks == 0 ) ) )
+			{
+				if( libfcache_cache_initialize(
+				     &( internal_file->compressed_blocks_cache ),
+				     internal_file->maximum_number_of_cache_entries,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create compressed blocks cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libagdb_compressed_block_cache_initialize(
+				     &( internal_file->compressed_block_cache ),
+				     number_of_compressed_blocks,
+				     number_of_cache_entries,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create compressed block cache.",
+					 function );
+
+					goto on_error;
+				}
+				if( number_of_read_ahead_blocks > 0 )
+				{
+					if( libagdb_compressed_block_read_ahead_initialize(
+					     &( internal_file->compressed_block_read_ahead ),
+					     number_of_compressed_blocks,
+					     number_of_read_ahead_blocks,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create compressed block read-ahead.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			/* The pool holds a block for every cache entry, every read-ahead block,
+			 * one for the block being read and one for a peeked block
+			 */
+			if( libagdb_compressed_block_pool_initialize(
+			     &( internal_file->compressed_block_pool ),
+			     (size_t) internal_file->io_handle->uncompressed_block_size,
+			     number_of_cache_entries + number_of_read_ahead_blocks + 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed block pool.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->io_handle->compressed_block_pool = internal_file->compressed_block_pool;
+		}
+		else
+		{
+			if( ( internal_file->io_handle->uncompressed_data_size == 0 )
+			 || ( (size_t) internal_file->io_handle->uncompressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid uncompressed data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->uncompressed_data = (uint8_t *) memory_allocate(
+			                                                sizeof( uint8_t ) * internal_file->io_handle->uncompressed_data_size );
+
+			if( internal_file->uncompressed_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     internal_file->uncompressed_data,
+			     0,
+			     sizeof( uint8_t ) * internal_file->io_handle->uncompressed_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			/* Use the file data if it is already in memory
+			 */
+			if( ( internal_file->mapped_file != NULL )
+			 && ( internal_file->mapped_file->data != NULL )
+			 && ( (size64_t) internal_file->mapped_file->data_size >= internal_file->io_handle->file_size ) )
+			{
+				file_data      = internal_file->mapped_file->data;
+				file_data_size = internal_file->mapped_file->data_size;
+			}
+			else if( ( internal_file->memory_data != NULL )
+			      && ( (size64_t) internal_file->memory_data_size >= internal_file->io_handle->file_size ) )
+			{
+				file_data      = internal_file->memory_data;
+				file_data_size = internal_file->memory_data_size;
+			}
+			if( libagdb_compressed_blocks_decompress(
+			     internal_file->compressed_blocks_list,
+			     internal_file->io_handle,
+			     file_io_handle,
+			     file_data,
+			     file_data_size,
+			     internal_file->uncompressed_data,
+			     (size_t) internal_file->io_handle->uncompressed_data_size,
+			     internal_file->number_of_decompression_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress compressed blocks.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_compressed_blocks_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     &( internal_file->io_handle->compressed_blocks_data_handle ),
+		     internal_file->compressed_blocks_list,
+		     internal_file->compressed_blocks_cache,
+		     internal_file->compressed_block_cache,
+		     internal_file->compressed_block_read_ahead,
+		     internal_file->io_handle,
+		     internal_file->uncompressed_data,
+		     (size_t) internal_file->io_handle->uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->uncompressed_data != NULL )
+		{
+			/* The uncompressed data outlives the volume and source information
+			 */
+			internal_file->io_handle->mapped_data      = internal_file->uncompressed_data;
+			internal_file->io_handle->mapped_data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     NULL,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_io_handle_read_segment_data,
+		     NULL,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libagdb_io_handle_seek_segment_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create uncompressed data stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_stream_append_segment(
+		     internal_file->uncompressed_data_stream,
+		     &segment_index,
+		     0,
+		     0,
+		     (size64_t) internal_file->io_handle->uncompressed_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append uncompressed data stream segment: 0.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_file->mapped_file != NULL )
+		 && ( internal_file->mapped_file->data != NULL )
+		 && ( (size64_t) internal_file->mapped_file->data_size >= internal_file->io_handle->uncompressed_data_size ) )
+		{
+			internal_file->io_handle->mapped_data      = internal_file->mapped_file->data;
+			internal_file->io_handle->mapped_data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+		}
+		else if( ( internal_file->memory_data != NULL )
+		      && ( (size64_t) internal_file->memory_data_size >= internal_file->io_handle->uncompressed_data_size ) )
+		{
+			internal_file->io_handle->mapped_data      = internal_file->memory_data;
+			internal_file->io_handle->mapped_data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+		}
+	}
+	if( libagdb_io_handle_read_uncompressed_file_header(
+	     internal_file->io_handle,
+	     internal_file->uncompressed_data_stream,
+	     file_io_handle,
+	     &file_offset,
+	     &number_of_volumes,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_volumes > (uint32_t) INT_MAX )
+	 || ( number_of_sources > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes or sources value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume and source information records are read on demand
+	 */
+	if( libcdata_array_resize(
+	     internal_file->volumes_array,
+	     (int) number_of_volumes,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volumes array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_resize(
+	     internal_file->sources_array,
+	     (int) number_of_sources,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sources array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->first_record_offset    = file_offset;
+	internal_file->next_record_offset     = file_offset;
+	internal_file->number_of_read_volumes = 0;
+	internal_file->number_of_read_sources = 0;
+
+	internal_file->io_handle->progress.number_of_volumes = number_of_volumes;
+	internal_file->io_handle->progress.number_of_sources = number_of_sources;
+
+	libagdb_io_handle_report_progress(
+	 internal_file->io_handle );
+
+	internal_file->io_handle->statistics.open_time += libagdb_statistics_get_timestamp() - timestamp;
+
+	return( 1 );
+
+on_error:
+	internal_file->io_handle->mapped_data                   = NULL;
+	internal_file->io_handle->mapped_data_size              = 0;
+	internal_file->io_handle->compressed_blocks_data_handle = NULL;
+
+	libcdata_array_resize(
+	 internal_file->sources_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	 NULL );
+	libcdata_array_resize(
+	 internal_file->volumes_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	 NULL );
+
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &( internal_file->uncompressed_data_stream ),
+		 NULL );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->uncompressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->compressed_blocks_cache ),
+		 NULL );
+	}
+	if( internal_file->compressed_block_read_ahead != NULL )
+	{
+		libagdb_compressed_block_read_ahead_free(
+		 &( internal_file->compressed_block_read_ahead ),
+		 NULL );
+	}
+	if( internal_file->compressed_block_cache != NULL )
+	{
+		libagdb_compressed_block_cache_free(
+		 &( internal_file->compressed_block_cache ),
+		 NULL );
+	}
+	if( internal_file->compressed_block_pool != NULL )
+	{
+		internal_file->io_handle->compressed_block_pool = NULL;
+
+		libagdb_compressed_block_pool_free(
+		 &( internal_file->compressed_block_pool ),
+		 NULL );
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->compressed_blocks_list ),
+		 NULL );
+	}
+	if( compressed_file_header != NULL )
+	{
+		libagdb_compressed_file_header_free(
+		 &compressed_file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the volume information records up to and including a specific volume index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_read_volume_information(
+     libagdb_internal_file_t *internal_file,
+     int volume_index,
+     libcerror_error_t **error )
+{
+	libagdb_volume_information_t *volume_information = NULL;
+	static char *function                            = "libagdb_internal_file_read_volume_information";
+	ssize64_t read_count                             = 0;
+	size_t alignment_padding_size                    = 0;
+	uint64_t parse_timestamp                         = 0;
+	int number_of_volumes                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index < 0 )
+	 || ( volume_index >= number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume information records are stored consecutively and have a variable size
+	 * hence all preceding records need to be read to determine the offset of a specific record
+	 */
+	while( internal_file->number_of_read_volumes <= volume_index )
+	{
+		if( libagdb_io_handle_check_abort(
+		     internal_file->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read volume: %d information.",
+			 function,
+			 internal_file->number_of_read_volumes );
+
+			goto on_error;
+		}
+		alignment_padding_size = (size_t) ( internal_file->next_record_offset % 8 );
+
+		if( alignment_padding_size != 0 )
+		{
+			alignment_padding_size = 8 - alignment_padding_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: alignment padding size\t\t\t\t: %" PRIzd "\n",
+				 function,
+				 alignment_padding_size );
+			}
+#endif
+			internal_file->next_record_offset += alignment_padding_size;
+		}
+		if( libagdb_volume_information_initialize(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume: %d information.",
+			 function,
+			 internal_file->number_of_read_volumes );
+
+			goto on_error;
+		}
+		parse_timestamp = libagdb_statistics_get_parse_timestamp(
+		                   &( internal_file->io_handle->statistics ) );
+
+		read_count = libagdb_internal_volume_information_read_file_io_handle(
+		              (libagdb_internal_volume_information_t *) volume_information,
+		              internal_file->io_handle,
+		              internal_file->uncompressed_data_stream,
+		              internal_file->file_io_handle,
+		              internal_file->next_record_offset,
+		              (uint32_t) internal_file->number_of_read_volumes,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume: %d information.",
+			 function,
+			 internal_file->number_of_read_volumes );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+		                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
+
+		if( libcdata_array_set_entry_by_index(
+		     internal_file->volumes_array,
+		     internal_file->number_of_read_volumes,
+		     (intptr_t *) volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume: %d information in array.",
+			 function,
+			 internal_file->number_of_read_volumes );
+
+			goto on_error;
+		}
+		volume_information = NULL;
+
+		internal_file->next_record_offset     += read_count;
+		internal_file->number_of_read_volumes += 1;
+
+		internal_file->io_handle->progress.number_of_parsed_volumes = (uint32_t) internal_file->number_of_read_volumes;
+
+		libagdb_io_handle_report_progress(
+		 internal_file->io_handle );
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libagdb_internal_volume_information_free(
+		 (libagdb_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the source information records up to and including a specific source index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_read_source_information(
+     libagdb_internal_file_t *internal_file,
+     int source_index,
+     libcerror_error_t **error )
+{
+	libagdb_source_information_t *source_information = NULL;
+	static char *function                            = "libagdb_internal_file_read_source_information";
+	ssize_t read_count                               = 0;
+	uint64_t parse_timestamp                         = 0;
+	int number_of_sources                            = 0;
+	int number_of_volumes                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_index < 0 )
+	 || ( source_index >= number_of_sources ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The source information records are stored after the volume information records
+	 */
+	if( internal_file->number_of_read_volumes < number_of_volumes )
+	{
+		if( libagdb_internal_file_read_volume_information(
+		     internal_file,
+		     number_of_volumes - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( internal_file->number_of_read_sources <= source_index )
+	{
+		if( libagdb_io_handle_check_abort(
+		     internal_file->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read source: %d information.",
+			 function,
+			 internal_file->number_of_read_sources );
+
+			goto on_error;
+		}
+		if( libagdb_source_information_initialize(
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source: %d information.",
+			 function,
+			 internal_file->number_of_read_sources );
+
+			goto on_error;
+		}
+		parse_timestamp = libagdb_statistics_get_parse_timestamp(
+		                   &( internal_file->io_handle->statistics ) );
+
+		read_count = libagdb_source_information_read(
+		              (libagdb_internal_source_information_t *) source_information,
+		              internal_file->io_handle,
+		              internal_file->uncompressed_data_stream,
+		              internal_file->file_io_handle,
+		              (uint32_t) internal_file->number_of_read_sources,
+		              internal_file->next_record_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %d information.",
+			 function,
+			 internal_file->number_of_read_sources );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+		                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
+
+		if( libcdata_array_set_entry_by_index(
+		     internal_file->sources_array,
+		     internal_file->number_of_read_sources,
+		     (intptr_t *) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source: %d information in array.",
+			 function,
+			 internal_file->number_of_read_sources );
+
+			goto on_error;
+		}
+		source_information = NULL;
+
+		internal_file->next_record_offset     += read_count;
+		internal_file->number_of_read_sources += 1;
+
+		internal_file->io_handle->progress.number_of_parsed_sources = (uint32_t) internal_file->number_of_read_sources;
+
+		libagdb_io_handle_report_progress(
+		 internal_file->io_handle );
+	}
+	return( 1 );
+
+on_error:
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_number_of_volumes(
+     libagdb_file_t *file,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_number_of_volumes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific volume information
+ * The volume information is read on demand and cached in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_volume_information(
+     libagdb_file_t *file,
+     int volume_index,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_volume_information";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->volumes_array,
+	     volume_index,
+	     (intptr_t **) volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( *volume_information == NULL )
+	{
+		if( libagdb_io_handle_start_activity(
+		     internal_file->io_handle,
+		     internal_file->io_handle->time_budget,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start activity.",
+			 function );
+
+			return( -1 );
+		}
+		result = libagdb_internal_file_read_volume_information(
+		          internal_file,
+		          volume_index,
+		          error );
+
+		internal_file->io_handle->deadline = 0;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_number_of_sources(
+     libagdb_file_t *file,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_number_of_sources";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific source information
+ * The source information is read on demand and cached in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_source_information(
+     libagdb_file_t *file,
+     int source_index,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_source_information";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sources_array,
+	     source_index,
+	     (intptr_t **) source_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %d information.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( *source_information == NULL )
+	{
+		if( libagdb_io_handle_start_activity(
+		     internal_file->io_handle,
+		     internal_file->io_handle->time_budget,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start activity.",
+			 function );
+
+			return( -1 );
+		}
+		result = libagdb_internal_file_read_source_information(
+		          internal_file,
+		          source_index,
+		          error );
+
+		internal_file->io_handle->deadline = 0;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %d information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index,
+		     (intptr_t **) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the source hash table
+ * All the source information records are read to determine their prefetch hash
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_build_source_hash_table(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libagdb_source_information_t *source_information = NULL;
+	static char *function                            = "libagdb_internal_file_build_source_hash_table";
+	uint32_t prefetch_hash                           = 0;
+	uint32_t slot_index                              = 0;
+	uint32_t source_hash_table_size                  = 0;
+	int number_of_sources                            = 0;
+	int result                                       = 0;
+	int source_index                                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->source_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - source hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the 100 and 144 byte source information entries contain a prefetch hash
+	 */
+	if( ( number_of_sources == 0 )
+	 || ( ( internal_file->io_handle->source_information_entry_size != 100 )
+	  &&  ( internal_file->io_handle->source_information_entry_size != 144 ) ) )
+	{
+		internal_file->source_hash_table_is_built = 1;
+
+		return( 1 );
+	}
+	if( internal_file->number_of_read_sources < number_of_sources )
+	{
+		if( libagdb_internal_file_read_source_information(
+		     internal_file,
+		     number_of_sources - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source information.",
 			 function );
 
+			return( -1 );
+		}
+	}
+	/* Use a load factor of at most 0.5 to keep the probe sequences short
+	 */
+	source_hash_table_size = 1;
+
+	while( source_hash_table_size < ( (uint32_t) number_of_sources * 2 ) )
+	{
+		source_hash_table_size <<= 1;
+	}
+	if( (size_t) source_hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->source_hash_table = (int *) memory_allocate(
+	                                            sizeof( int ) * source_hash_table_size );
+
+	if( internal_file->source_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_file->source_hash_table,
+	     0,
+	     sizeof( int ) * source_hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index,
+		     (intptr_t **) &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
+
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		result = libagdb_source_information_get_prefetch_hash(
+		          source_information,
+		          &prefetch_hash,
+		          error );
+
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "Reading compressed blocks:\n" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d prefetch hash.",
+			 function,
+			 source_index );
+
+			goto on_error;
 		}
-#endif
-		if( libagdb_io_handle_read_compressed_blocks(
+		else if( result == 0 )
+		{
+			continue;
+		}
+		slot_index = prefetch_hash & ( source_hash_table_size - 1 );
+
+		while( internal_file->source_hash_table[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( source_hash_table_size - 1 );
+		}
+		internal_file->source_hash_table[ slot_index ] = source_index + 1;
+	}
+	internal_file->source_hash_table_size     = source_hash_table_size;
+	internal_file->source_hash_table_is_built = 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->source_hash_table != NULL )
+	{
+		memory_free(
+		 internal_file->source_hash_table );
+
+		internal_file->source_hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the source information of a specific prefetch hash
+ * If multiple source information records have the same prefetch hash the first one is returned
+ * Returns 1 if successful, 0 if no such source information or -1 on error
+ */
+int libagdb_file_get_source_information_by_prefetch_hash(
+     libagdb_file_t *file,
+     uint32_t prefetch_hash,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file                = NULL;
+	libagdb_source_information_t *safe_source_information = NULL;
+	static char *function                                 = "libagdb_file_get_source_information_by_prefetch_hash";
+	uint32_t slot_index                                   = 0;
+	uint32_t source_prefetch_hash                         = 0;
+	int result                                            = 0;
+	int source_index                                      = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->source_hash_table_is_built == 0 )
+	{
+		if( libagdb_io_handle_start_activity(
 		     internal_file->io_handle,
-		     file_io_handle,
-		     internal_file->compressed_blocks_list,
+		     internal_file->io_handle->time_budget,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed blocks.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start activity.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfcache_cache_initialize(
-		     &( internal_file->compressed_blocks_cache ),
-		     LIBAGDB_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
-		     error ) != 1 )
+		result = libagdb_internal_file_build_source_hash_table(
+		          internal_file,
+		          error );
+
+		internal_file->io_handle->deadline = 0;
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks cache.",
+			 "%s: unable to build source hash table.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libagdb_compressed_blocks_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
+	}
+	if( internal_file->source_hash_table == NULL )
+	{
+		return( 0 );
+	}
+	slot_index = prefetch_hash & ( internal_file->source_hash_table_size - 1 );
+
+	while( internal_file->source_hash_table[ slot_index ] != 0 )
+	{
+		source_index = internal_file->source_hash_table[ slot_index ] - 1;
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index,
+		     (intptr_t **) &safe_source_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks stream.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( libagdb_source_information_get_prefetch_hash(
+		     safe_source_information,
+		     &source_prefetch_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d prefetch hash.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( source_prefetch_hash == prefetch_hash )
+		{
+			*source_information = safe_source_information;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( internal_file->source_hash_table_size - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a pointer to the uncompressed data at a specific offset
+ * The data is referenced and remains valid until libagdb_file_release_data
+ * or libagdb_file_close is called, only one peek can be outstanding at a time.
+ * The data size contains the number of bytes that can be accessed. When the
+ * uncompressed data is in memory, because the file is memory mapped, read into
+ * memory or all its compressed blocks were decompressed on open, this is the
+ * remainder of the uncompressed data. Otherwise it is limited to the end of
+ * the compressed block that contains the offset or, if the data is copied,
+ * to the size of the internal peek buffer.
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_peek_data(
+     libagdb_file_t *file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_peek_data";
+	size64_t stream_size                   = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->data_is_peeked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - peeked data has not been released.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_size(
+	     internal_file->uncompressed_data_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The time budget does not apply to peeking data, which reads at most a single compressed block
+	 */
+	internal_file->io_handle->deadline = 0;
+
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		if( (size_t) offset >= internal_file->io_handle->mapped_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		*data      = &( internal_file->io_handle->mapped_data[ offset ] );
+		*data_size = internal_file->io_handle->mapped_data_size - (size_t) offset;
+
+		internal_file->data_is_peeked = 1;
+
+		return( 1 );
 	}
-	else
+	if( internal_file->io_handle->compressed_blocks_data_handle != NULL )
 	{
-		if( libfdata_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     NULL,
-		     NULL,
-		     NULL,
-		     NULL,
-		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_io_handle_read_segment_data,
-		     NULL,
-		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libagdb_io_handle_seek_segment_offset,
-		     0,
-		     error ) != 1 )
+		/* The compressed block that contains the data is pinned so that
+		 * it is not evicted by subsequent reads
+		 */
+		result = libagdb_compressed_blocks_stream_data_handle_pin_data(
+		          internal_file->io_handle->compressed_blocks_data_handle,
+		          internal_file->file_io_handle,
+		          offset,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pin data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_file->data_is_peeked = 1;
+
+			return( 1 );
+		}
+	}
+	/* The data cannot be referenced and is copied into the peek buffer
+	 */
+	if( internal_file->peek_buffer == NULL )
+	{
+		internal_file->peek_buffer = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * LIBAGDB_RECORD_BUFFER_SPAN_SIZE );
+
+		if( internal_file->peek_buffer == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create uncompressed data stream.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create peek buffer.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdata_stream_append_segment(
-		     internal_file->uncompressed_data_stream,
-		     &segment_index,
-		     0,
-		     0,
-		     (size64_t) internal_file->io_handle->uncompressed_data_size,
-		     0,
+	}
+	read_size = LIBAGDB_RECORD_BUFFER_SPAN_SIZE;
+
+	if( (size64_t) read_size > ( stream_size - (size64_t) offset ) )
+	{
+		read_size = (size_t) ( stream_size - (size64_t) offset );
+	}
+	internal_file->peek_buffer_size = 0;
+
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_file->uncompressed_data_stream,
+	              (intptr_t *) internal_file->file_io_handle,
+	              internal_file->peek_buffer,
+	              read_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	internal_file->io_handle->statistics.number_of_stream_reads += 1;
+	internal_file->io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
+	internal_file->peek_buffer_size = read_size;
+
+	*data      = internal_file->peek_buffer;
+	*data_size = internal_file->peek_buffer_size;
+
+	internal_file->data_is_peeked = 1;
+
+	return( 1 );
+}
+
+/* Releases the data retrieved by libagdb_file_peek_data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_release_data(
+     libagdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_release_data";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->data_is_peeked == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_file->io_handle->compressed_blocks_data_handle != NULL )
+	{
+		if( libagdb_compressed_blocks_stream_data_handle_unpin_data(
+		     internal_file->io_handle->compressed_blocks_data_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append uncompressed data stream segment: 0.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unpin data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libagdb_io_handle_read_uncompressed_file_header(
-	     internal_file->io_handle,
-	     internal_file->uncompressed_data_stream,
-	     file_io_handle,
-	     &file_offset,
+	internal_file->data_is_peeked = 0;
+
+	return( 1 );
+}
+
+/* Scans the volume, file and source information records in a single forward pass
+ * The callbacks are invoked for every record in the order the records are stored,
+ * a callback that is NULL is not invoked. The volume, file and source information
+ * passed to a callback are only valid while the callback is invoked.
+ * The files of a volume are only provided by the file callback, if no file callback
+ * is set the file information records are skipped without being parsed.
+ * A callback returns 1 to continue the scan, 0 to stop it or -1 on error
+ * The scan is stopped when the time budget is exceeded
+ * Returns 1 if all records were scanned, 0 if a callback or the time budget stopped the scan or -1 on error
+ */
+int libagdb_file_scan(
+     libagdb_file_t *file,
+     int (*volume_callback)(
+            libagdb_volume_information_t *volume_information,
+            int volume_index,
+            void *user_data ),
+     int (*file_callback)(
+            libagdb_volume_information_t *volume_information,
+            int volume_index,
+            libagdb_file_information_t *file_information,
+            int file_index,
+            void *user_data ),
+     int (*source_callback)(
+            libagdb_source_information_t *source_information,
+            int source_index,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *file_information                       = NULL;
+	libagdb_internal_file_t *internal_file                             = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_source_information_t *source_information                   = NULL;
+	libagdb_volume_information_t *volume_information                   = NULL;
+	static char *function                                              = "libagdb_file_scan";
+	size64_t record_size                                               = 0;
+	ssize64_t read_count                                               = 0;
+	off64_t file_offset                                                = 0;
+	uint64_t parse_timestamp                                           = 0;
+	uint32_t file_index                                                = 0;
+	int number_of_sources                                              = 0;
+	int number_of_volumes                                              = 0;
+	int result                                                         = 1;
+	int source_index                                                   = 0;
+	int volume_index                                                   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->uncompressed_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
 	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
 	     &number_of_sources,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( libagdb_io_handle_start_activity(
+	     internal_file->io_handle,
+	     internal_file->io_handle->time_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start activity.",
+		 function );
+
+		return( -1 );
 	}
+	file_offset = internal_file->first_record_offset;
+
 	for( volume_index = 0;
 	     volume_index < number_of_volumes;
 	     volume_index++ )
 	{
-		alignment_padding_size = (size_t) ( file_offset % 8 );
-
-		if( alignment_padding_size != 0 )
+		if( libagdb_io_handle_check_abort(
+		     internal_file->io_handle,
+		     error ) != 0 )
 		{
-			alignment_padding_size = 8 - alignment_padding_size;
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: alignment padding size\t\t\t\t: %" PRIzd "\n",
-				 function,
-				 alignment_padding_size );
-			}
-#endif
-			read_count = libfdata_stream_read_buffer(
-			              internal_file->uncompressed_data_stream,
-			              (intptr_t *) internal_file->file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) alignment_padding_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read alignment padding data.",
-				 function );
-
-				goto on_error;
-			}
-			file_offset += read_count;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read volume: %d information.",
+			 function,
+			 volume_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: alignment padding data:\n",
-				 function );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
+			goto on_error;
+		}
+		if( ( file_offset % 8 ) != 0 )
+		{
+			file_offset += 8 - ( file_offset % 8 );
 		}
 		if( libagdb_volume_information_initialize(
 		     &volume_information,
@@ -1230,19 +4149,24 @@ int libagdb_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create volume: %" PRIu32 " information.",
+			 "%s: unable to create volume: %d information.",
 			 function,
 			 volume_index );
 
 			goto on_error;
 		}
-		read_count = libagdb_internal_volume_information_read_file_io_handle(
-		              (libagdb_internal_volume_information_t *) volume_information,
+		internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+		parse_timestamp = libagdb_statistics_get_parse_timestamp(
+		                   &( internal_file->io_handle->statistics ) );
+
+		read_count = libagdb_internal_volume_information_read_header_file_io_handle(
+		              internal_volume_information,
 		              internal_file->io_handle,
 		              internal_file->uncompressed_data_stream,
 		              internal_file->file_io_handle,
 		              file_offset,
-		              volume_index,
+		              (uint32_t) volume_index,
 		              error );
 
 		if( read_count == -1 )
@@ -1251,36 +4175,233 @@ int libagdb_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volume: %" PRIu32 " information.",
+			 "%s: unable to read volume: %d information.",
 			 function,
 			 volume_index );
 
 			goto on_error;
 		}
-		file_offset += read_count;
-
-		if( libcdata_array_append_entry(
-		     internal_file->volumes_array,
-		     &entry_index,
-		     (intptr_t *) volume_information,
+		internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+		                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
+
+		file_offset += (off64_t) read_count;
+
+		internal_file->io_handle->progress.number_of_parsed_volumes = (uint32_t) volume_index + 1;
+		internal_file->io_handle->progress.number_of_parsed_files   = 0;
+		internal_file->io_handle->progress.number_of_files          = internal_volume_information->number_of_files;
+
+		libagdb_io_handle_report_progress(
+		 internal_file->io_handle );
+
+		if( volume_callback != NULL )
+		{
+			result = volume_callback(
+			          volume_information,
+			          volume_index,
+			          user_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: volume callback failed for volume: %d.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+		}
+		for( file_index = 0;
+		     ( result == 1 ) && ( file_index < internal_volume_information->number_of_files );
+		     file_index++ )
+		{
+			if( libagdb_io_handle_check_abort(
+			     internal_file->io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: unable to read volume: %d file: %" PRIu32 " information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			if( file_callback == NULL )
+			{
+				parse_timestamp = libagdb_statistics_get_parse_timestamp(
+				                   &( internal_file->io_handle->statistics ) );
+
+				if( libagdb_file_information_read_record_size(
+				     internal_file->io_handle,
+				     internal_volume_information->record_buffer,
+				     internal_file->uncompressed_data_stream,
+				     internal_file->file_io_handle,
+				     file_offset,
+				     file_index,
+				     &record_size,
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read volume: %d file: %" PRIu32 " information record size.",
+					 function,
+					 volume_index,
+					 file_index );
+
+					goto on_error;
+				}
+				internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+				                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
+
+				file_offset += (off64_t) record_size;
+
+				internal_file->io_handle->progress.number_of_parsed_files = file_index + 1;
+
+				libagdb_io_handle_report_progress(
+				 internal_file->io_handle );
+
+				continue;
+			}
+			if( libagdb_file_information_initialize(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create volume: %d file: %" PRIu32 " information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			parse_timestamp = libagdb_statistics_get_parse_timestamp(
+			                   &( internal_file->io_handle->statistics ) );
+
+			read_count = (ssize64_t) libagdb_internal_file_information_read_file_io_handle(
+			                          (libagdb_internal_file_information_t *) file_information,
+			                          internal_file->io_handle,
+			                          internal_volume_information->record_buffer,
+			                          NULL,
+			                          NULL,
+			                          0,
+			                          internal_file->uncompressed_data_stream,
+			                          internal_file->file_io_handle,
+			                          file_offset,
+			                          file_index,
+			                          error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read volume: %d file: %" PRIu32 " information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+			                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
+
+			file_offset += (off64_t) read_count;
+
+			internal_file->io_handle->progress.number_of_parsed_files = file_index + 1;
+
+			libagdb_io_handle_report_progress(
+			 internal_file->io_handle );
+
+			result = file_callback(
+			          volume_information,
+			          volume_index,
+			          file_information,
+			          (int) file_index,
+			          user_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: file callback failed for volume: %d file: %" PRIu32 ".",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			if( libagdb_internal_file_information_free(
+			     (libagdb_internal_file_information_t **) &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume: %d file: %" PRIu32 " information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_internal_volume_information_free(
+		     (libagdb_internal_volume_information_t **) &volume_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append volume: %" PRIu32 " information to array.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
 			 function,
 			 volume_index );
 
 			goto on_error;
 		}
-		volume_information = NULL;
+		if( result == 0 )
+		{
+			internal_file->io_handle->deadline = 0;
+
+			return( 0 );
+		}
 	}
+	/* The source information records are stored after the volume information records
+	 */
 	for( source_index = 0;
-	     source_index < number_of_sources;
+	     ( source_callback != NULL ) && ( source_index < number_of_sources );
 	     source_index++ )
 	{
+		if( libagdb_io_handle_check_abort(
+		     internal_file->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read source: %d information.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
 		if( libagdb_source_information_initialize(
 		     &source_information,
 		     error ) != 1 )
@@ -1289,20 +4410,23 @@ int libagdb_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create source: %" PRIu32 " information.",
+			 "%s: unable to create source: %d information.",
 			 function,
 			 source_index );
 
 			goto on_error;
 		}
-		read_count = libagdb_source_information_read(
-		              (libagdb_internal_source_information_t *) source_information,
-		              internal_file->io_handle,
-		              internal_file->uncompressed_data_stream,
-		              internal_file->file_io_handle,
-		              source_index,
-		              file_offset,
-		              error );
+		parse_timestamp = libagdb_statistics_get_parse_timestamp(
+		                   &( internal_file->io_handle->statistics ) );
+
+		read_count = (ssize64_t) libagdb_source_information_read(
+		                          (libagdb_internal_source_information_t *) source_information,
+		                          internal_file->io_handle,
+		                          internal_file->uncompressed_data_stream,
+		                          internal_file->file_io_handle,
+		                          (uint32_t) source_index,
+		                          file_offset,
+		                          error );
 
 		if( read_count == -1 )
 		{
@@ -1310,69 +4434,62 @@ int libagdb_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read source: %" PRIu32 " information.",
+			 "%s: unable to read source: %d information.",
 			 function,
 			 source_index );
 
 			goto on_error;
 		}
-		file_offset += read_count;
+		internal_file->io_handle->statistics.parse_time += libagdb_statistics_get_parse_timestamp(
+		                                                    &( internal_file->io_handle->statistics ) ) - parse_timestamp;
 
-		if( libcdata_array_append_entry(
-		     internal_file->sources_array,
-		     &entry_index,
-		     (intptr_t *) source_information,
-		     error ) != 1 )
+		file_offset += (off64_t) read_count;
+
+		internal_file->io_handle->progress.number_of_parsed_sources = (uint32_t) source_index + 1;
+
+		libagdb_io_handle_report_progress(
+		 internal_file->io_handle );
+
+		result = source_callback(
+		          source_information,
+		          source_index,
+		          user_data );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append source: %" PRIu32 " information to array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: source callback failed for source: %d.",
 			 function,
 			 source_index );
 
 			goto on_error;
 		}
-		source_information = NULL;
-	}
-/* TODO remove use offset instead */
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		uint8_t trailing_data[ 128 ];
-
-		read_count = libfdata_stream_read_buffer(
-			      internal_file->uncompressed_data_stream,
-			      (intptr_t *) internal_file->file_io_handle,
-			      trailing_data,
-			      128,
-			      0,
-			      error );
-
-		if( read_count == -1 )
+		if( libagdb_internal_source_information_free(
+		     (libagdb_internal_source_information_t **) &source_information,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read trailing data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source: %d information.",
+			 function,
+			 source_index );
 
 			goto on_error;
 		}
-		if( read_count > 0 )
+		if( result == 0 )
 		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 read_count,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			internal_file->io_handle->deadline = 0;
+
+			return( 0 );
 		}
 	}
-#endif
+	internal_file->io_handle->deadline = 0;
+
 	return( 1 );
 
 on_error:
@@ -1382,156 +4499,60 @@ on_error:
 		 (libagdb_internal_source_information_t **) &source_information,
 		 NULL );
 	}
-	if( volume_information != NULL )
-	{
-		libagdb_internal_volume_information_free(
-		 (libagdb_internal_volume_information_t **) &volume_information,
-		 NULL );
-	}
-	if( internal_file->uncompressed_data_stream != NULL )
-	{
-		libfdata_stream_free(
-		 &( internal_file->uncompressed_data_stream ),
-		 NULL );
-	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( internal_file->compressed_blocks_cache ),
-		 NULL );
-	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( file_information != NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->compressed_blocks_list ),
+		libagdb_internal_file_information_free(
+		 (libagdb_internal_file_information_t **) &file_information,
 		 NULL );
 	}
-	if( compressed_file_header != NULL )
+	if( volume_information != NULL )
 	{
-		libagdb_compressed_file_header_free(
-		 &compressed_file_header,
+		libagdb_internal_volume_information_free(
+		 (libagdb_internal_volume_information_t **) &volume_information,
 		 NULL );
 	}
-	return( -1 );
-}
-
-/* Retrieves the number of volumes
- * Returns 1 if successful or -1 on error
- */
-int libagdb_file_get_number_of_volumes(
-     libagdb_file_t *file,
-     int *number_of_volumes,
-     libcerror_error_t **error )
-{
-	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_number_of_volumes";
-
-	if( file == NULL )
+	result = -1;
+
+	/* Exceeding the time budget is not an error, the records scanned so far
+	 * were provided to the callbacks
+	 */
+	if( ( internal_file->io_handle->abort == 0 )
+	 && ( libagdb_io_handle_check_abort(
+	       internal_file->io_handle,
+	       NULL ) != 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		if( error == NULL )
+		{
+			result = 0;
+		}
+		else if( libcerror_error_matches(
+		          *error,
+		          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED ) != 0 )
+		{
+			libcerror_error_free(
+			 error );
 
-		return( -1 );
+			result = 0;
+		}
 	}
-	internal_file = (libagdb_internal_file_t *) file;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->volumes_array,
-	     number_of_volumes,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
-		 function );
+	internal_file->io_handle->deadline = 0;
 
-		return( -1 );
-	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves a specific volume information
- * Returns 1 if successful or -1 on error
- */
-int libagdb_file_get_volume_information(
-     libagdb_file_t *file,
-     int volume_index,
-     libagdb_volume_information_t **volume_information,
-     libcerror_error_t **error )
-{
-	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_volume_information";
-
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
-	}
-	internal_file = (libagdb_internal_file_t *) file;
-
-	if( volume_information == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume information.",
-		 function );
-
-		return( -1 );
-	}
-	if( *volume_information != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume information value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->volumes_array,
-	     volume_index,
-	     (intptr_t **) volume_information,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume: %d information.",
-		 function,
-		 volume_index );
-
-		return( -1 );
-	}
-	return( 1 );
-}
 
-/* Retrieves the number of sources
+/* Retrieves the statistics
+ * The statistics are gathered from the moment the file is opened and reset when the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_get_number_of_sources(
+int libagdb_file_get_statistics(
      libagdb_file_t *file,
-     int *number_of_sources,
+     libagdb_statistics_t *statistics,
      libcerror_error_t **error )
 {
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_number_of_sources";
+	static char *function                  = "libagdb_file_get_statistics";
 
 	if( file == NULL )
 	{
@@ -1546,86 +4567,42 @@ int libagdb_file_get_number_of_sources(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sources_array,
-	     number_of_sources,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sources.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves a specific source information
- * Returns 1 if successful or -1 on error
- */
-int libagdb_file_get_source_information(
-     libagdb_file_t *file,
-     int source_index,
-     libagdb_source_information_t **source_information,
-     libcerror_error_t **error )
-{
-	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_source_information";
-
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libagdb_internal_file_t *) file;
-
-	if( source_information == NULL )
+	if( statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid source information.",
+		 "%s: invalid statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( *source_information != NULL )
+	if( memory_copy(
+	     statistics,
+	     &( internal_file->io_handle->statistics ),
+	     sizeof( libagdb_statistics_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid source information value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->sources_array,
-	     source_index,
-	     (intptr_t **) source_information,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve source: %d information.",
-		 function,
-		 source_index );
-
-		return( -1 );
-	}
 	return( 1 );
 }
 
@@ -25,6 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_compressed_block_cache.h"
+#include "libagdb_compressed_block_pool.h"
+#include "libagdb_compressed_block_read_ahead.h"
 #include "libagdb_extern.h"
 #include "libagdb_io_handle.h"
 #include "libagdb_libbfio.h"
@@ -32,6 +35,9 @@
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_mapped_file.h"
+#include "libagdb_progress.h"
+#include "libagdb_statistics.h"
 #include "libagdb_types.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32_VERSION ) || defined( __MINGW64_VERSION_MAJOR )
@@ -66,6 +72,28 @@ struct libagdb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory mapped file, when the file was opened with the memory map access flag
+	 */
+	libagdb_mapped_file_t *mapped_file;
+
+	/* The file data, when the file was read into memory with the read into memory access flag
+	 * NULL if the memory mapped file data is used instead
+	 */
+	uint8_t *file_data;
+
+	/* The data of the file in memory, when the file was read into memory or opened from memory
+	 */
+	const uint8_t *memory_data;
+
+	/* The size of the data of the file in memory
+	 */
+	size_t memory_data_size;
+
+	/* The file IO handle the file was opened with, when the file was read into memory
+	 * the file IO handle then refers to the file data in memory
+	 */
+	libbfio_handle_t *source_file_io_handle;
+
 	/* The compressed blocks list
 	 */
 	libfdata_list_t *compressed_blocks_list;
@@ -74,10 +102,60 @@ struct libagdb_internal_file
 	 */
 	libfcache_cache_t *compressed_blocks_cache;
 
+	/* The compressed block cache, used when a least recently used or pin all cache policy is set
+	 */
+	libagdb_compressed_block_cache_t *compressed_block_cache;
+
+	/* The maximum number of compressed blocks cache entries
+	 */
+	int maximum_number_of_cache_entries;
+
+	/* The compressed blocks cache policy
+	 */
+	int cache_policy;
+
+	/* The compressed block pool
+	 */
+	libagdb_compressed_block_pool_t *compressed_block_pool;
+
+	/* The number of compressed blocks that are read ahead
+	 * 0 represents read-ahead is disabled
+	 */
+	int number_of_read_ahead_blocks;
+
+	/* The compressed block read-ahead
+	 */
+	libagdb_compressed_block_read_ahead_t *compressed_block_read_ahead;
+
 	/* The uncompressed data stream
 	 */
 	libfdata_stream_t *uncompressed_data_stream;
 
+	/* The number of threads used to decompress all compressed blocks on open
+	 * 0 represents the compressed blocks are decompressed on demand
+	 */
+	int number_of_decompression_threads;
+
+	/* The uncompressed data, when all compressed blocks are decompressed on open
+	 */
+	uint8_t *uncompressed_data;
+
+	/* Value to indicate data was peeked and has not been released
+	 */
+	uint8_t data_is_peeked;
+
+	/* The peek buffer, used when the peeked data cannot be referenced
+	 */
+	uint8_t *peek_buffer;
+
+	/* The size of the peek buffer
+	 */
+	size_t peek_buffer_size;
+
+	/* The minimum number of uncompressed bytes between MAM decoder checkpoints
+	 */
+	size_t mam_checkpoint_interval;
+
 	/* The volumes array
 	 */
 	libcdata_array_t *volumes_array;
@@ -85,6 +163,36 @@ struct libagdb_internal_file
 	/* The sources array
 	 */
 	libcdata_array_t *sources_array;
+
+	/* The offset of the first volume information record
+	 */
+	off64_t first_record_offset;
+
+	/* The offset of the next volume or source information record to read
+	 */
+	off64_t next_record_offset;
+
+	/* The number of volume information records read
+	 */
+	int number_of_read_volumes;
+
+	/* The number of source information records read
+	 */
+	int number_of_read_sources;
+
+	/* The source hash table, which maps a prefetch hash onto the source index + 1 of the source
+	 * information record using open addressing, where 0 represents an empty slot
+	 * NULL if the table was not built or the source information records do not contain prefetch hashes
+	 */
+	int *source_hash_table;
+
+	/* The number of slots in the source hash table, which is a power of 2
+	 */
+	uint32_t source_hash_table_size;
+
+	/* Value to indicate the source hash table was built
+	 */
+	uint8_t source_hash_table_is_built;
 };
 
 LIBAGDB_EXTERN \
@@ -102,6 +210,57 @@ int libagdb_file_signal_abort(
      libagdb_file_t *file,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_set_number_of_decompression_threads(
+     libagdb_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_mam_checkpoint_interval(
+     libagdb_file_t *file,
+     size_t checkpoint_interval,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_maximum_cache_entries(
+     libagdb_file_t *file,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_cache_policy(
+     libagdb_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_number_of_read_ahead_blocks(
+     libagdb_file_t *file,
+     int number_of_blocks,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_time_budget(
+     libagdb_file_t *file,
+     uint64_t time_budget,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_progress_callback(
+     libagdb_file_t *file,
+     int (*progress_callback)(
+            const libagdb_progress_t *progress,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_verify_hashes(
+     libagdb_file_t *file,
+     uint8_t verify_hashes,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_open(
      libagdb_file_t *file,
@@ -120,6 +279,14 @@ int libagdb_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBAGDB_EXTERN \
+int libagdb_file_open_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_open_file_io_handle(
      libagdb_file_t *file,
@@ -132,11 +299,29 @@ int libagdb_file_close(
      libagdb_file_t *file,
      libcerror_error_t **error );
 
+int libagdb_internal_file_read_into_memory(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_close_file_data_io_handle(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 int libagdb_file_open_read(
      libagdb_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libagdb_internal_file_read_volume_information(
+     libagdb_internal_file_t *internal_file,
+     int volume_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_read_source_information(
+     libagdb_internal_file_t *internal_file,
+     int source_index,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_get_number_of_volumes(
      libagdb_file_t *file,
@@ -163,6 +348,56 @@ int libagdb_file_get_source_information(
      libagdb_source_information_t **source_information,
      libcerror_error_t **error );
 
+int libagdb_internal_file_build_source_hash_table(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_source_information_by_prefetch_hash(
+     libagdb_file_t *file,
+     uint32_t prefetch_hash,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_peek_data(
+     libagdb_file_t *file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_release_data(
+     libagdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_scan(
+     libagdb_file_t *file,
+     int (*volume_callback)(
+            libagdb_volume_information_t *volume_information,
+            int volume_index,
+            void *user_data ),
+     int (*file_callback)(
+            libagdb_volume_information_t *volume_information,
+            int volume_index,
+            libagdb_file_information_t *file_information,
+            int file_index,
+            void *user_data ),
+     int (*source_callback)(
+            libagdb_source_information_t *source_information,
+            int source_index,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_statistics(
+     libagdb_file_t *file,
+     libagdb_statistics_t *statistics,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
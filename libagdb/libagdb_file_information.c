@@ -35,6 +35,8 @@
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libuna.h"
+#include "libagdb_path_pool.h"
+#include "libagdb_record_buffer.h"
 
 #include "agdb_file_information.h"
 
@@ -161,11 +163,18 @@ int libagdb_internal_file_information_free(
 	}
 	if( *internal_file_information != NULL )
 	{
-		if( ( *internal_file_information )->path != NULL )
+		if( ( ( *internal_file_information )->path != NULL )
+		 && ( ( *internal_file_information )->path_is_referenced == 0 ) )
 		{
 			memory_free(
 			 ( *internal_file_information )->path );
 		}
+		if( ( ( *internal_file_information )->sub_entries_data != NULL )
+		 && ( ( *internal_file_information )->sub_entries_data_is_referenced == 0 ) )
+		{
+			memory_free(
+			 ( *internal_file_information )->sub_entries_data );
+		}
 		memory_free(
 		 *internal_file_information );
 
@@ -295,7 +304,9 @@ on_error:
 
 		internal_file_information->path = NULL;
 	}
-	internal_file_information->path_size = 0;
+	internal_file_information->path_size      = 0;
+	internal_file_information->utf8_path_size = 0;
+	internal_file_information->path_is_ascii  = 0;
 
 	return( -1 );
 }
@@ -311,7 +322,6 @@ int libagdb_internal_file_information_read_data(
      libcerror_error_t **error )
 {
 	static char *function = "libagdb_internal_file_information_read_data";
-	uint32_t flags        = 0;
 	uint8_t mode          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -414,13 +424,17 @@ int libagdb_internal_file_information_read_data(
 	}
 	if( mode == 32 )
 	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (agdb_file_information_36_t *) data )->name_hash,
+		 internal_file_information->name_hash );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_36_t *) data )->number_of_entries,
 		 internal_file_information->number_of_entries );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_36_t *) data )->flags,
-		 flags );
+		 internal_file_information->flags );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_36_t *) data )->path_number_of_characters,
@@ -428,13 +442,20 @@ int libagdb_internal_file_information_read_data(
 	}
 	else if( mode == 64 )
 	{
+		/* Only the lower 32-bit of the 64-bit name hash are used, it is not known
+		 * if these match the hash of the path
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (agdb_file_information_64_t *) data )->name_hash,
+		 internal_file_information->name_hash );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_64_t *) data )->number_of_entries,
 		 internal_file_information->number_of_entries );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_64_t *) data )->flags,
-		 flags );
+		 internal_file_information->flags );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (agdb_file_information_64_t *) data )->path_number_of_characters,
@@ -485,7 +506,7 @@ int libagdb_internal_file_information_read_data(
 		libcnotify_printf(
 		 "%s: flags\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 flags );
+		 internal_file_information->flags );
 
 		if( mode == 32 )
 		{
@@ -928,33 +949,98 @@ int libagdb_internal_file_information_read_data(
 		internal_file_information->path_size <<= 1;
 		internal_file_information->path_size  += 2;
 	}
+	internal_file_information->utf8_path_size = 0;
+	internal_file_information->path_is_ascii  = 0;
+
+	io_handle->statistics.number_of_parsed_records += 1;
+
+	return( 1 );
+}
+
+/* Checks if the file information sub entry sizes are supported
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_information_check_sub_entry_sizes(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_file_information_check_sub_entry_sizes";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_information_sub_entry_type1_size != 16 )
+	 && ( io_handle->file_information_sub_entry_type1_size != 24 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file information sub entry type 1 size: %" PRIu32 ".",
+		 function,
+		 io_handle->file_information_sub_entry_type1_size );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_information_sub_entry_type2_size != 16 )
+	 && ( io_handle->file_information_sub_entry_type2_size != 20 )
+	 && ( io_handle->file_information_sub_entry_type2_size != 24 )
+	 && ( io_handle->file_information_sub_entry_type2_size != 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file information sub entry type 2 size: %" PRIu32 ".",
+		 function,
+		 io_handle->file_information_sub_entry_type2_size );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
 /* Reads the file information
+ * The record is retrieved from the record buffer. If the uncompressed data is mapped
+ * into memory the path and sub entries reference the mapped data
+ * Otherwise the sub entries are copied into the sub entries buffer, if provided, which
+ * must be the size of the sub entries data
  * Returns the number of bytes read if successful or -1 on error
  */
 ssize_t libagdb_internal_file_information_read_file_io_handle(
          libagdb_internal_file_information_t *internal_file_information,
          libagdb_io_handle_t *io_handle,
+         libagdb_record_buffer_t *record_buffer,
+         libagdb_path_pool_t *path_pool,
+         uint8_t *sub_entries_buffer,
+         size_t sub_entries_buffer_size,
          libfdata_stream_t *data_stream,
          libbfio_handle_t *file_io_handle,
          off64_t file_offset,
          uint32_t file_index,
          libcerror_error_t **error )
 {
-	uint8_t alignment_padding_data[ 8 ];
-	uint8_t sub_entry_data[ 32 ];
-
-	uint8_t *file_information_data = NULL;
+	const uint8_t *record_data     = NULL;
 	static char *function          = "libagdb_internal_file_information_read_file_io_handle";
 	size_t alignment_padding_size  = 0;
 	size_t alignment_size          = 0;
-	ssize_t read_count             = 0;
+	size_t sub_entries_data_size   = 0;
 	ssize_t total_read_count       = 0;
 	uint32_t calculated_hash_value = 0;
-	uint32_t entry_index           = 0;
 	uint32_t sub_entry_data_size   = 0;
+	uint8_t verify_hash            = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t entry_index           = 0;
+#endif
 
 	if( internal_file_information == NULL )
 	{
@@ -978,6 +1064,17 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( internal_file_information->sub_entries_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file information - sub entries data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1001,20 +1098,6 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		return( -1 );
 	}
-	file_information_data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * (size_t) io_handle->file_information_entry_size );
-
-	if( file_information_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file information data.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1026,16 +1109,15 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              data_stream,
-	              (intptr_t *) file_io_handle,
-	              file_information_data,
-	              (size_t) io_handle->file_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->file_information_entry_size )
+	if( libagdb_record_buffer_get_data(
+	     record_buffer,
+	     io_handle,
+	     data_stream,
+	     file_io_handle,
+	     file_offset,
+	     (size_t) io_handle->file_information_entry_size,
+	     &record_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1049,13 +1131,13 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	total_read_count += read_count;
-	file_offset      += read_count;
+	total_read_count += (ssize_t) io_handle->file_information_entry_size;
+	file_offset      += (off64_t) io_handle->file_information_entry_size;
 
 	if( libagdb_internal_file_information_read_data(
 	     internal_file_information,
 	     io_handle,
-	     file_information_data,
+	     record_data,
 	     (size_t) io_handle->file_information_entry_size,
 	     error ) != 1 )
 	{
@@ -1069,22 +1151,21 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 file_information_data );
-
-	file_information_data = NULL;
-
 	if( ( io_handle->file_information_entry_size == 36 )
 	 || ( io_handle->file_information_entry_size == 52 )
 	 || ( io_handle->file_information_entry_size == 56 )
 	 || ( io_handle->file_information_entry_size == 72 ) )
 	{
 		alignment_size = 4;
+		verify_hash    = io_handle->verify_hashes;
 	}
 	else if( ( io_handle->file_information_entry_size == 64 )
 	      || ( io_handle->file_information_entry_size == 88 )
 	      || ( io_handle->file_information_entry_size == 112 ) )
 	{
+		/* The name hash of 64-bit records is not verified since it is not known
+		 * if it matches the hash of the path
+		 */
 		alignment_size = 8;
 	}
 	else
@@ -1112,29 +1193,15 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 			goto on_error;
 		}
-		internal_file_information->path = (uint8_t *) memory_allocate(
-		                                               sizeof( uint8_t ) * internal_file_information->path_size );
-
-		if( internal_file_information->path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create path.",
-			 function );
-
-			goto on_error;
-		}
-		read_count = libfdata_stream_read_buffer(
-		              data_stream,
-		              (intptr_t *) file_io_handle,
-		              internal_file_information->path,
-		              internal_file_information->path_size,
-		              0,
-		              error );
-
-		if( read_count != (ssize_t) internal_file_information->path_size )
+		if( libagdb_record_buffer_get_data(
+		     record_buffer,
+		     io_handle,
+		     data_stream,
+		     file_io_handle,
+		     file_offset,
+		     (size_t) internal_file_information->path_size,
+		     &record_data,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1146,8 +1213,68 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 			goto on_error;
 		}
-		total_read_count += read_count;
-		file_offset      += read_count;
+		if( io_handle->mapped_data != NULL )
+		{
+			/* The mapped data outlives the file information
+			 */
+			internal_file_information->path               = (uint8_t *) record_data;
+			internal_file_information->path_is_referenced = 1;
+		}
+		else if( path_pool != NULL )
+		{
+			/* The path pool outlives the file information
+			 */
+			if( libagdb_path_pool_append(
+			     path_pool,
+			     record_data,
+			     (size_t) internal_file_information->path_size,
+			     &( internal_file_information->path ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append path to pool.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file_information->path_is_referenced = 1;
+		}
+		else
+		{
+			internal_file_information->path = (uint8_t *) memory_allocate(
+			                                               sizeof( uint8_t ) * internal_file_information->path_size );
+
+			if( internal_file_information->path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create path.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     internal_file_information->path,
+			     record_data,
+			     internal_file_information->path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		total_read_count += (ssize_t) internal_file_information->path_size;
+		file_offset      += (off64_t) internal_file_information->path_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1162,18 +1289,46 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 			 0 );
 		}
 #endif
-		if( libagdb_hash_calculate(
-		     &calculated_hash_value,
-		     internal_file_information->path,
-		     internal_file_information->path_size - 2,
-		     error ) != 1 )
+		/* The path hash is only calculated when verification of the hashes was requested,
+		 * since it is not needed to read the file information
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( verify_hash != 0 )
+		 || ( libcnotify_verbose != 0 ) )
+#else
+		if( verify_hash != 0 )
+#endif
+		{
+			if( libagdb_hash_calculate(
+			     &calculated_hash_value,
+			     internal_file_information->path,
+			     internal_file_information->path_size - 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path hash value.",
+				 function );
+
+				goto on_error;
+			}
+			io_handle->statistics.number_of_hash_calculations += 1;
+			io_handle->statistics.hashed_size                 += internal_file_information->path_size - 2;
+		}
+		if( ( verify_hash != 0 )
+		 && ( calculated_hash_value != internal_file_information->name_hash ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path hash value.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in file: %" PRIu32 " path hash value (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 file_index,
+			 internal_file_information->name_hash,
+			 calculated_hash_value );
 
 			goto on_error;
 		}
@@ -1221,182 +1376,615 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 				 alignment_padding_size );
 			}
 #endif
-			read_count = libfdata_stream_read_buffer(
-			              data_stream,
-			              (intptr_t *) file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) alignment_padding_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file: %" PRIu32 " alignment padding data.",
-				 function,
-				 file_index );
-
-				goto on_error;
-			}
-			total_read_count += read_count;
-			file_offset      += read_count;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: file: %" PRIu32 " alignment padding data:\n",
-				 function,
-				 file_index );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
+			total_read_count += (ssize_t) alignment_padding_size;
+			file_offset      += (off64_t) alignment_padding_size;
 		}
 	}
 	if( internal_file_information->number_of_entries > 0 )
 	{
-		if( ( io_handle->file_information_sub_entry_type1_size != 16 )
-		 && ( io_handle->file_information_sub_entry_type1_size != 24 ) )
+		if( libagdb_file_information_check_sub_entry_sizes(
+		     io_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported file information sub entry type 1 size: %" PRIu32 ".",
-			 function,
-			 io_handle->file_information_sub_entry_type1_size );
+			 "%s: unsupported file information sub entry sizes.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( io_handle->file_information_sub_entry_type2_size != 16 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 20 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 24 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 32 ) )
+		sub_entry_data_size = io_handle->file_information_sub_entry_type1_size;
+
+		if( (size_t) internal_file_information->number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sub_entry_data_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported file information sub entry type 2 size: %" PRIu32 ".",
-			 function,
-			 io_handle->file_information_sub_entry_type2_size );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file information - number of entries value out of bounds.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		sub_entry_data_size = io_handle->file_information_sub_entry_type1_size;
-
-		for( entry_index = 0;
-		     entry_index < internal_file_information->number_of_entries;
-		     entry_index++ )
+		sub_entries_data_size = (size_t) internal_file_information->number_of_entries * sub_entry_data_size;
+
+		/* The sub entries are contiguous and are retrieved at once
+		 */
+		if( libagdb_record_buffer_get_data(
+		     record_buffer,
+		     io_handle,
+		     data_stream,
+		     file_io_handle,
+		     file_offset,
+		     sub_entries_data_size,
+		     &record_data,
+		     error ) != 1 )
 		{
-			read_count = libfdata_stream_read_buffer(
-				      data_stream,
-				      (intptr_t *) file_io_handle,
-				      sub_entry_data,
-				      (size_t) sub_entry_data_size,
-				      0,
-				      error );
-
-			if( read_count != (ssize_t) sub_entry_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub entry: %" PRIu32 " data.",
-				 function,
-				 entry_index );
-
-				goto on_error;
-			}
-			total_read_count += read_count;
-			file_offset      += read_count;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file: %" PRIu32 " sub entries data.",
+			 function,
+			 file_index );
 
+			goto on_error;
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		if( libcnotify_verbose != 0 )
+		{
+			for( entry_index = 0;
+			     entry_index < internal_file_information->number_of_entries;
+			     entry_index++ )
 			{
 				libcnotify_printf(
 				 "%s: sub entry: %" PRIu32 " data:\n",
 				 function,
 				 entry_index );
 				libcnotify_print_data(
-				 sub_entry_data,
+				 &( record_data[ entry_index * sub_entry_data_size ] ),
 				 (size_t) sub_entry_data_size,
 				 0 );
 			}
+		}
 #endif
+		if( io_handle->mapped_data != NULL )
+		{
+			/* The mapped data outlives the file information
+			 */
+			internal_file_information->sub_entries_data               = (uint8_t *) record_data;
+			internal_file_information->sub_entries_data_is_referenced = 1;
+		}
+		else
+		{
+			if( sub_entries_buffer != NULL )
+			{
+				if( sub_entries_buffer_size != sub_entries_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid sub entries buffer size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				/* The sub entries buffer outlives the file information
+				 */
+				internal_file_information->sub_entries_data               = sub_entries_buffer;
+				internal_file_information->sub_entries_data_is_referenced = 1;
+			}
+			else
+			{
+				internal_file_information->sub_entries_data = (uint8_t *) memory_allocate(
+				                                                          sizeof( uint8_t ) * sub_entries_data_size );
+
+				if( internal_file_information->sub_entries_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create sub entries data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( memory_copy(
+			     internal_file_information->sub_entries_data,
+			     record_data,
+			     sub_entries_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sub entries data.",
+				 function );
+
+				goto on_error;
+			}
 		}
+		internal_file_information->sub_entry_size = sub_entry_data_size;
+
+		total_read_count += (ssize_t) sub_entries_data_size;
+		file_offset      += (off64_t) sub_entries_data_size;
 	}
 	return( total_read_count );
 
 on_error:
 	if( internal_file_information->path != NULL )
 	{
-		memory_free(
-		 internal_file_information->path );
-
+		if( internal_file_information->path_is_referenced == 0 )
+		{
+			memory_free(
+			 internal_file_information->path );
+		}
 		internal_file_information->path = NULL;
 	}
-	internal_file_information->path_size = 0;
+	internal_file_information->path_size          = 0;
+	internal_file_information->path_is_referenced = 0;
+	internal_file_information->utf8_path_size     = 0;
+	internal_file_information->path_is_ascii      = 0;
 
-	if( file_information_data != NULL )
+	if( internal_file_information->sub_entries_data != NULL )
 	{
-		memory_free(
-		 file_information_data );
+		if( internal_file_information->sub_entries_data_is_referenced == 0 )
+		{
+			memory_free(
+			 internal_file_information->sub_entries_data );
+		}
+		internal_file_information->sub_entries_data = NULL;
 	}
+	internal_file_information->sub_entry_size                 = 0;
+	internal_file_information->sub_entries_data_is_referenced = 0;
+
 	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded path
- * The returned size includes the end of string character
+/* Reads the size of a file information record
+ * This only reads the fixed-size part of the record, the path and sub entries are skipped
+ * The values of the record are stored in the file table, which is optional and can be NULL
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_information_get_utf8_path_size(
-     libagdb_file_information_t *file_information,
-     size_t *utf8_string_size,
+int libagdb_file_information_read_record_size(
+     libagdb_io_handle_t *io_handle,
+     libagdb_record_buffer_t *record_buffer,
+     libfdata_stream_t *data_stream,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t file_index,
+     size64_t *record_size,
+     libagdb_file_table_t *file_table,
      libcerror_error_t **error )
 {
-	libagdb_internal_file_information_t *internal_file_information = NULL;
-	static char *function                                          = "libagdb_file_information_get_utf8_path_size";
+	libagdb_internal_file_information_t internal_file_information;
 
-	if( file_information == NULL )
+	const uint8_t *record_data    = NULL;
+	static char *function         = "libagdb_file_information_read_record_size";
+	size64_t safe_record_size     = 0;
+	size_t alignment_padding_size = 0;
+	size_t alignment_size         = 0;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file information.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file_information = (libagdb_internal_file_information_t *) file_information;
-
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_file_information->path,
-	     internal_file_information->path_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( ( io_handle->file_information_entry_size == 0 )
+	 || ( io_handle->file_information_entry_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve path UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - file information entry size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &internal_file_information,
+	     0,
+	     sizeof( libagdb_internal_file_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_record_buffer_get_data(
+	     record_buffer,
+	     io_handle,
+	     data_stream,
+	     file_io_handle,
+	     file_offset,
+	     (size_t) io_handle->file_information_entry_size,
+	     &record_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_index,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( libagdb_internal_file_information_read_data(
+	     &internal_file_information,
+	     io_handle,
+	     record_data,
+	     (size_t) io_handle->file_information_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %" PRIu32 " information.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	/* The entry size was validated by libagdb_internal_file_information_read_data
+	 */
+	if( ( io_handle->file_information_entry_size == 64 )
+	 || ( io_handle->file_information_entry_size >= 88 ) )
+	{
+		alignment_size = 8;
+	}
+	else
+	{
+		alignment_size = 4;
+	}
+	safe_record_size = (size64_t) io_handle->file_information_entry_size;
+
+	if( internal_file_information.path_size > 0 )
+	{
+		safe_record_size += internal_file_information.path_size;
+
+		alignment_padding_size = (size_t) ( ( file_offset + safe_record_size ) % alignment_size );
+
+		if( alignment_padding_size != 0 )
+		{
+			safe_record_size += alignment_size - alignment_padding_size;
+		}
+	}
+	if( internal_file_information.number_of_entries > 0 )
+	{
+		if( libagdb_file_information_check_sub_entry_sizes(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported file information sub entry sizes.",
+			 function );
+
+			return( -1 );
+		}
+		safe_record_size += (size64_t) internal_file_information.number_of_entries
+		                  * io_handle->file_information_sub_entry_type1_size;
+	}
+	if( file_table != NULL )
+	{
+		if( libagdb_file_table_set_entry(
+		     file_table,
+		     (int) file_index,
+		     file_offset,
+		     internal_file_information.name_hash,
+		     internal_file_information.flags,
+		     internal_file_information.number_of_entries,
+		     file_offset + io_handle->file_information_entry_size,
+		     internal_file_information.path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file: %" PRIu32 " in file table.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	*record_size = safe_record_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_information_get_number_of_sub_entries(
+     libagdb_file_information_t *file_information,
+     int *number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information = NULL;
+	static char *function                                          = "libagdb_file_information_get_number_of_sub_entries";
+
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+	if( internal_file_information->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file information - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sub_entries = (int) internal_file_information->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the sub entries
+ * The sub entries are stored contiguously, where sub entry N starts at offset N * sub entry size
+ * The sub entries data is owned by the file information or the volume information it was retrieved
+ * from and must not be freed. The data is NULL if there are no sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_information_get_sub_entries(
+     libagdb_file_information_t *file_information,
+     const uint8_t **sub_entries_data,
+     size_t *sub_entry_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information = NULL;
+	static char *function                                          = "libagdb_file_information_get_sub_entries";
+
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+	if( sub_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub entry size.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_entries_data = internal_file_information->sub_entries_data;
+	*sub_entry_size   = (size_t) internal_file_information->sub_entry_size;
+
+	return( 1 );
+}
+
+/* Determines if 4 UTF-16 little-endian code units are non-zero ASCII characters
+ */
+#define libagdb_file_information_is_ascii_4units( data ) \
+	( ( ( ( data )[ 1 ] | ( data )[ 3 ] | ( data )[ 5 ] | ( data )[ 7 ] ) == 0 ) \
+	 && ( ( ( ( data )[ 0 ] | ( data )[ 2 ] | ( data )[ 4 ] | ( data )[ 6 ] ) & 0x80 ) == 0 ) \
+	 && ( ( data )[ 0 ] != 0 ) \
+	 && ( ( data )[ 2 ] != 0 ) \
+	 && ( ( data )[ 4 ] != 0 ) \
+	 && ( ( data )[ 6 ] != 0 ) )
+
+/* Retrieves the size of the UTF-8 encoded path
+ * The size is determined once and cached, paths that only contain ASCII characters
+ * are checked 4 code units at a time instead of being converted by libuna
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_information_get_utf8_path_size(
+     libagdb_internal_file_information_t *internal_file_information,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_file_information_get_utf8_path_size";
+	size_t path_index     = 0;
+	uint8_t path_is_ascii = 0;
+
+	if( internal_file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_information->utf8_path_size == 0 )
+	{
+		/* Paths that contain non-ASCII characters, including a byte-order mark,
+		 * or have an odd size are converted by libuna
+		 */
+		if( ( internal_file_information->path != NULL )
+		 && ( ( internal_file_information->path_size % 2 ) == 0 ) )
+		{
+			while( ( path_index + 8 ) <= internal_file_information->path_size )
+			{
+				if( !libagdb_file_information_is_ascii_4units(
+				      &( internal_file_information->path[ path_index ] ) ) )
+				{
+					break;
+				}
+				path_index += 8;
+			}
+			path_is_ascii = 1;
+
+			while( path_index < internal_file_information->path_size )
+			{
+				if( ( internal_file_information->path[ path_index + 1 ] != 0 )
+				 || ( internal_file_information->path[ path_index ] >= 0x80 ) )
+				{
+					path_is_ascii = 0;
+
+					break;
+				}
+				if( internal_file_information->path[ path_index ] == 0 )
+				{
+					break;
+				}
+				path_index += 2;
+			}
+		}
+		if( path_is_ascii != 0 )
+		{
+			internal_file_information->utf8_path_size = ( path_index / 2 ) + 1;
+		}
+		else if( libuna_utf8_string_size_from_utf16_stream(
+		          internal_file_information->path,
+		          internal_file_information->path_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          &( internal_file_information->utf8_path_size ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path UTF-8 string size.",
+			 function );
+
+			internal_file_information->utf8_path_size = 0;
+
+			return( -1 );
+		}
+		internal_file_information->path_is_ascii = path_is_ascii;
+	}
+	*utf8_string_size = internal_file_information->utf8_path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_information_get_utf8_path_size(
+     libagdb_file_information_t *file_information,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_file_information_get_utf8_path_size";
+
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_file_information_get_utf8_path_size(
+	     (libagdb_internal_file_information_t *) file_information,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the UTF-8 encoded path
  * The size should include the end of string character
  * Returns 1 if successful or -1 on error
@@ -1409,6 +1997,9 @@ int libagdb_file_information_get_utf8_path(
 {
 	libagdb_internal_file_information_t *internal_file_information = NULL;
 	static char *function                                          = "libagdb_file_information_get_utf8_path";
+	size_t path_index                                              = 0;
+	size_t string_index                                            = 0;
+	size_t safe_utf8_string_size                                   = 0;
 
 	if( file_information == NULL )
 	{
@@ -1423,13 +2014,82 @@ int libagdb_file_information_get_utf8_path(
 	}
 	internal_file_information = (libagdb_internal_file_information_t *) file_information;
 
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     internal_file_information->path,
-	     internal_file_information->path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_file_information_get_utf8_path_size(
+	     internal_file_information,
+	     &safe_utf8_string_size,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < safe_utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_information->path_is_ascii != 0 )
+	{
+		/* Narrow the UTF-16 code units to bytes, 4 code units at a time
+		 */
+		while( ( string_index + 5 ) <= safe_utf8_string_size )
+		{
+			utf8_string[ string_index ]     = internal_file_information->path[ path_index ];
+			utf8_string[ string_index + 1 ] = internal_file_information->path[ path_index + 2 ];
+			utf8_string[ string_index + 2 ] = internal_file_information->path[ path_index + 4 ];
+			utf8_string[ string_index + 3 ] = internal_file_information->path[ path_index + 6 ];
+
+			string_index += 4;
+			path_index   += 8;
+		}
+		while( ( string_index + 1 ) < safe_utf8_string_size )
+		{
+			utf8_string[ string_index++ ] = internal_file_information->path[ path_index ];
+
+			path_index += 2;
+		}
+		utf8_string[ string_index ] = 0;
+	}
+	else if( libuna_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          internal_file_information->path,
+	          internal_file_information->path_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
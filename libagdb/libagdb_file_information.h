@@ -26,11 +26,14 @@
 #include <types.h>
 
 #include "libagdb_extern.h"
+#include "libagdb_file_table.h"
 #include "libagdb_io_handle.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_path_pool.h"
+#include "libagdb_record_buffer.h"
 #include "libagdb_types.h"
 
 #if defined( __cplusplus )
@@ -49,9 +52,41 @@ struct libagdb_internal_file_information
 	 */
 	uint32_t path_size;
 
+	/* Value to indicate the path references data that is not owned by the file information
+	 */
+	uint8_t path_is_referenced;
+
+	/* The cached UTF-8 path size, which is 0 if not yet determined
+	 */
+	size_t utf8_path_size;
+
+	/* Value to indicate the path only contains ASCII characters
+	 */
+	uint8_t path_is_ascii;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
 	/* The number of entries
 	 */
 	uint32_t number_of_entries;
+
+	/* The sub entries data
+	 */
+	uint8_t *sub_entries_data;
+
+	/* The size of a sub entry
+	 */
+	uint32_t sub_entry_size;
+
+	/* Value to indicate the sub entries data references data that is not owned by the file information
+	 */
+	uint8_t sub_entries_data_is_referenced;
 };
 
 int libagdb_file_information_initialize(
@@ -80,15 +115,52 @@ int libagdb_internal_file_information_read_path_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libagdb_file_information_check_sub_entry_sizes(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 ssize_t libagdb_internal_file_information_read_file_io_handle(
          libagdb_internal_file_information_t *internal_file_information,
          libagdb_io_handle_t *io_handle,
+         libagdb_record_buffer_t *record_buffer,
+         libagdb_path_pool_t *path_pool,
+         uint8_t *sub_entries_buffer,
+         size_t sub_entries_buffer_size,
          libfdata_stream_t *data_stream,
          libbfio_handle_t *file_io_handle,
          off64_t file_offset,
          uint32_t file_index,
          libcerror_error_t **error );
 
+int libagdb_file_information_read_record_size(
+     libagdb_io_handle_t *io_handle,
+     libagdb_record_buffer_t *record_buffer,
+     libfdata_stream_t *data_stream,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t file_index,
+     size64_t *record_size,
+     libagdb_file_table_t *file_table,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_information_get_number_of_sub_entries(
+     libagdb_file_information_t *file_information,
+     int *number_of_sub_entries,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_information_get_sub_entries(
+     libagdb_file_information_t *file_information,
+     const uint8_t **sub_entries_data,
+     size_t *sub_entry_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_information_get_utf8_path_size(
+     libagdb_internal_file_information_t *internal_file_information,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_information_get_utf8_path_size(
      libagdb_file_information_t *file_information,
@@ -0,0 +1,392 @@
+/*
+ * File table functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_file_table.h"
+#include "libagdb_libcerror.h"
+
+/* Creates a file table
+ * Make sure the value file_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_table_initialize(
+     libagdb_file_table_t **file_table,
+     int number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_file_table_initialize";
+
+	if( file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_files <= 0 )
+	 || ( (size_t) number_of_files > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_table = memory_allocate_structure(
+	               libagdb_file_table_t );
+
+	if( *file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_table,
+	     0,
+	     sizeof( libagdb_file_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file table.",
+		 function );
+
+		memory_free(
+		 *file_table );
+
+		*file_table = NULL;
+
+		return( -1 );
+	}
+	( *file_table )->record_offsets = (off64_t *) memory_allocate(
+	                                               sizeof( off64_t ) * number_of_files );
+
+	if( ( *file_table )->record_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->name_hashes = (uint32_t *) memory_allocate(
+	                                             sizeof( uint32_t ) * number_of_files );
+
+	if( ( *file_table )->name_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->flags = (uint32_t *) memory_allocate(
+	                                       sizeof( uint32_t ) * number_of_files );
+
+	if( ( *file_table )->flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create flags.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->number_of_entries = (uint32_t *) memory_allocate(
+	                                                   sizeof( uint32_t ) * number_of_files );
+
+	if( ( *file_table )->number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->first_entry_indexes = (uint64_t *) memory_allocate(
+	                                                     sizeof( uint64_t ) * number_of_files );
+
+	if( ( *file_table )->first_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create first entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->path_offsets = (off64_t *) memory_allocate(
+	                                             sizeof( off64_t ) * number_of_files );
+
+	if( ( *file_table )->path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->path_sizes = (uint32_t *) memory_allocate(
+	                                            sizeof( uint32_t ) * number_of_files );
+
+	if( ( *file_table )->path_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path sizes.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_table )->number_of_files = number_of_files;
+
+	return( 1 );
+
+on_error:
+	if( *file_table != NULL )
+	{
+		if( ( *file_table )->record_offsets != NULL )
+		{
+			memory_free(
+			 ( *file_table )->record_offsets );
+		}
+		if( ( *file_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->name_hashes );
+		}
+		if( ( *file_table )->flags != NULL )
+		{
+			memory_free(
+			 ( *file_table )->flags );
+		}
+		if( ( *file_table )->number_of_entries != NULL )
+		{
+			memory_free(
+			 ( *file_table )->number_of_entries );
+		}
+		if( ( *file_table )->first_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->first_entry_indexes );
+		}
+		if( ( *file_table )->path_offsets != NULL )
+		{
+			memory_free(
+			 ( *file_table )->path_offsets );
+		}
+		if( ( *file_table )->path_sizes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->path_sizes );
+		}
+		memory_free(
+		 *file_table );
+
+		*file_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file table
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_table_free(
+     libagdb_file_table_t **file_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_file_table_free";
+
+	if( file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_table != NULL )
+	{
+		if( ( *file_table )->record_offsets != NULL )
+		{
+			memory_free(
+			 ( *file_table )->record_offsets );
+		}
+		if( ( *file_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->name_hashes );
+		}
+		if( ( *file_table )->flags != NULL )
+		{
+			memory_free(
+			 ( *file_table )->flags );
+		}
+		if( ( *file_table )->number_of_entries != NULL )
+		{
+			memory_free(
+			 ( *file_table )->number_of_entries );
+		}
+		if( ( *file_table )->first_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->first_entry_indexes );
+		}
+		if( ( *file_table )->path_offsets != NULL )
+		{
+			memory_free(
+			 ( *file_table )->path_offsets );
+		}
+		if( ( *file_table )->path_sizes != NULL )
+		{
+			memory_free(
+			 ( *file_table )->path_sizes );
+		}
+		memory_free(
+		 *file_table );
+
+		*file_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the values of a specific entry
+ * The entries must be set in order since the index of the first (sub) entry
+ * is derived from the preceding entry
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_table_set_entry(
+     libagdb_file_table_t *file_table,
+     int file_index,
+     off64_t record_offset,
+     uint32_t name_hash,
+     uint32_t flags,
+     uint32_t number_of_entries,
+     off64_t path_offset,
+     uint32_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libagdb_file_table_set_entry";
+	uint64_t first_entry_index = 0;
+
+	if( file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= file_table->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index != file_table->number_of_set_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file index: %d, expected: %d.",
+		 function,
+		 file_index,
+		 file_table->number_of_set_files );
+
+		return( -1 );
+	}
+	if( file_index > 0 )
+	{
+		first_entry_index = file_table->first_entry_indexes[ file_index - 1 ]
+		                  + file_table->number_of_entries[ file_index - 1 ];
+	}
+	file_table->record_offsets[ file_index ]      = record_offset;
+	file_table->name_hashes[ file_index ]         = name_hash;
+	file_table->flags[ file_index ]               = flags;
+	file_table->number_of_entries[ file_index ]   = number_of_entries;
+	file_table->first_entry_indexes[ file_index ] = first_entry_index;
+	file_table->path_offsets[ file_index ]        = path_offset;
+	file_table->path_sizes[ file_index ]          = path_size;
+
+	file_table->number_of_set_files += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * File table functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_FILE_TABLE_H )
+#define _LIBAGDB_FILE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_file_table libagdb_file_table_t;
+
+/* The file table contains the values of the file information records of a volume,
+ * stored per value in arrays that are indexed by the file index
+ */
+struct libagdb_file_table
+{
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of files that were set
+	 */
+	int number_of_set_files;
+
+	/* The file information record offsets
+	 */
+	off64_t *record_offsets;
+
+	/* The name hashes
+	 */
+	uint32_t *name_hashes;
+
+	/* The flags
+	 */
+	uint32_t *flags;
+
+	/* The number of (sub) entries
+	 */
+	uint32_t *number_of_entries;
+
+	/* The index of the first (sub) entry relative to the first file of the volume
+	 */
+	uint64_t *first_entry_indexes;
+
+	/* The path offsets
+	 */
+	off64_t *path_offsets;
+
+	/* The path sizes
+	 */
+	uint32_t *path_sizes;
+};
+
+int libagdb_file_table_initialize(
+     libagdb_file_table_t **file_table,
+     int number_of_files,
+     libcerror_error_t **error );
+
+int libagdb_file_table_free(
+     libagdb_file_table_t **file_table,
+     libcerror_error_t **error );
+
+int libagdb_file_table_set_entry(
+     libagdb_file_table_t *file_table,
+     int file_index,
+     off64_t record_offset,
+     uint32_t name_hash,
+     uint32_t flags,
+     uint32_t number_of_entries,
+     off64_t path_offset,
+     uint32_t path_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_FILE_TABLE_H ) */
+
@@ -25,6 +25,66 @@
 #include "libagdb_hash.h"
 #include "libagdb_libcerror.h"
 
+/* The powers of the hash multiplier 0x25 modulo 2^32
+ * The hash is a polynomial of the data bytes in the multiplier, hence the hash of
+ * 8 bytes is the dot product of the bytes with the powers 0x25^7 to 0x25^0 and
+ * the previous hash value is multiplied by 0x25^8
+ */
+static const uint32_t libagdb_hash_multiplier_powers[ 9 ] = {
+	0x00000001UL, 0x00000025UL, 0x00000559UL, 0x0000c5ddUL, 0x001c98f1UL,
+	0x04221ad5UL, 0x98ede0c9UL, 0x1a617d0dUL, 0xd01712e1UL };
+
+/* Updates the hash value with 8 bytes of data
+ */
+#define libagdb_hash_update_8bytes( hash_value, data ) \
+	( hash_value ) = ( ( hash_value ) * libagdb_hash_multiplier_powers[ 8 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 7 ] * ( data )[ 0 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 6 ] * ( data )[ 1 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 5 ] * ( data )[ 2 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 4 ] * ( data )[ 3 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 3 ] * ( data )[ 4 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 2 ] * ( data )[ 5 ] ) \
+	               + ( libagdb_hash_multiplier_powers[ 1 ] * ( data )[ 6 ] ) \
+	               + ( data )[ 7 ]
+
+/* Updates the hash value with the data
+ * Returns the updated hash value
+ */
+static uint32_t libagdb_hash_update(
+                 uint32_t hash_value,
+                 const uint8_t *data,
+                 size_t data_size )
+{
+	size_t data_offset = 0;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		libagdb_hash_update_8bytes(
+		 hash_value,
+		 &( data[ data_offset ] ) );
+
+		libagdb_hash_update_8bytes(
+		 hash_value,
+		 &( data[ data_offset + 8 ] ) );
+
+		data_offset += 16;
+	}
+	if( ( data_offset + 8 ) <= data_size )
+	{
+		libagdb_hash_update_8bytes(
+		 hash_value,
+		 &( data[ data_offset ] ) );
+
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		hash_value *= 0x25;
+		hash_value += data[ data_offset++ ];
+	}
+	return( hash_value );
+}
+
 /* Calculates the hash of the data
  * Returns 1 if successful or -1 on error
  */
@@ -35,8 +95,6 @@ int libagdb_hash_calculate(
      libcerror_error_t **error )
 {
 	static char *function = "libagdb_hash_calculate";
-	size_t data_offset    = 0;
-	uint32_t value_32bit  = 0;
 
 	if( hash_value == NULL )
 	{
@@ -71,34 +129,172 @@ int libagdb_hash_calculate(
 
 		return( -1 );
 	}
-	*hash_value = 0x00004cb2fUL;
+	*hash_value = libagdb_hash_update(
+	               0x00004cb2fUL,
+	               data,
+	               data_size );
 
-	for( data_offset = 0;
-	     ( data_offset + 8 ) < data_size;
-	     data_offset += 8 )
+	return( 1 );
+}
+
+/* Calculates the hashes of multiple data
+ * The data are hashed in groups of LIBAGDB_HASH_NUMBER_OF_LANES, where the 8-byte steps
+ * of the data in a group are interleaved, so that the independent multiply chains can be
+ * executed in parallel and vectorized by the compiler
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_hash_calculate_multiple(
+     uint32_t *hash_values,
+     const uint8_t **data,
+     const size_t *data_sizes,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint32_t lane_hash_values[ LIBAGDB_HASH_NUMBER_OF_LANES ];
+
+	static char *function   = "libagdb_hash_calculate_multiple";
+	size_t common_data_size = 0;
+	size_t data_offset      = 0;
+	int lane_index          = 0;
+	int number_of_lanes     = 0;
+	int value_index         = 0;
+
+	if( hash_values == NULL )
 	{
-		value_32bit  = data[ data_offset + 1 ];
-		value_32bit *= 0x25;
-		value_32bit += data[ data_offset + 2 ];
-		value_32bit *= 0x25;
-		value_32bit += data[ data_offset + 3 ];
-		value_32bit *= 0x25;
-		value_32bit += data[ data_offset + 4 ];
-		value_32bit *= 0x25;
-		value_32bit += data[ data_offset + 5 ];
-		value_32bit *= 0x25;
-		value_32bit += data[ data_offset + 6 ];
-		value_32bit *= 0x25;
-
-		value_32bit += 0x1a617d0dUL * data[ data_offset ];
-
-		*hash_value = value_32bit - ( 0x2fe8ed1fUL * *hash_value ) + data[ data_offset + 7 ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
 	}
-	while( data_offset < data_size )
+	if( data == NULL )
 	{
-		 *hash_value *= 0x25;
-		 *hash_value += data[ data_offset++ ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( data[ value_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid data: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( data_sizes[ value_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data: %d size value exceeds maximum.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index += LIBAGDB_HASH_NUMBER_OF_LANES )
+	{
+		number_of_lanes = number_of_values - value_index;
+
+		if( number_of_lanes > LIBAGDB_HASH_NUMBER_OF_LANES )
+		{
+			number_of_lanes = LIBAGDB_HASH_NUMBER_OF_LANES;
+		}
+		common_data_size = data_sizes[ value_index ];
+
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			lane_hash_values[ lane_index ] = 0x00004cb2fUL;
+
+			if( data_sizes[ value_index + lane_index ] < common_data_size )
+			{
+				common_data_size = data_sizes[ value_index + lane_index ];
+			}
+		}
+		/* Hash the part of the data that all lanes have in common in lock step
+		 */
+		if( number_of_lanes == LIBAGDB_HASH_NUMBER_OF_LANES )
+		{
+			for( data_offset = 0;
+			     ( data_offset + 8 ) <= common_data_size;
+			     data_offset += 8 )
+			{
+				libagdb_hash_update_8bytes(
+				 lane_hash_values[ 0 ],
+				 &( data[ value_index ][ data_offset ] ) );
+
+				libagdb_hash_update_8bytes(
+				 lane_hash_values[ 1 ],
+				 &( data[ value_index + 1 ][ data_offset ] ) );
+
+				libagdb_hash_update_8bytes(
+				 lane_hash_values[ 2 ],
+				 &( data[ value_index + 2 ][ data_offset ] ) );
+
+				libagdb_hash_update_8bytes(
+				 lane_hash_values[ 3 ],
+				 &( data[ value_index + 3 ][ data_offset ] ) );
+			}
+		}
+		else
+		{
+			data_offset = 0;
+		}
+		/* Hash the remainder of the data of the individual lanes
+		 */
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			hash_values[ value_index + lane_index ] = libagdb_hash_update(
+			                                           lane_hash_values[ lane_index ],
+			                                           &( data[ value_index + lane_index ][ data_offset ] ),
+			                                           data_sizes[ value_index + lane_index ] - data_offset );
+		}
 	}
 	return( 1 );
 }
-
@@ -31,12 +31,23 @@
 extern "C" {
 #endif
 
+/* The number of data that are hashed in lock step by libagdb_hash_calculate_multiple
+ */
+#define LIBAGDB_HASH_NUMBER_OF_LANES	4
+
 int libagdb_hash_calculate(
      uint32_t *hash_value,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+int libagdb_hash_calculate_multiple(
+     uint32_t *hash_values,
+     const uint8_t **data,
+     const size_t *data_sizes,
+     int number_of_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
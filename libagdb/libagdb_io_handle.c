@@ -32,6 +32,7 @@
 #include "libagdb_libcnotify.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_statistics.h"
 #include "libagdb_unused.h"
 
 #include "agdb_file_header.h"
@@ -144,13 +145,22 @@ int libagdb_io_handle_free(
 }
 
 /* Clears the IO handle
+ * The time budget, progress callback and hash verification are retained,
+ * since these are set independent of the file being open
  * Returns 1 if successful or -1 on error
  */
 int libagdb_io_handle_clear(
      libagdb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libagdb_io_handle_clear";
+	int (*progress_callback)(
+	       const libagdb_progress_t *progress,
+	       void *user_data ) = NULL;
+
+	void *progress_user_data = NULL;
+	static char *function    = "libagdb_io_handle_clear";
+	uint64_t time_budget     = 0;
+	uint8_t verify_hashes    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -163,6 +173,11 @@ int libagdb_io_handle_clear(
 
 		return( -1 );
 	}
+	time_budget        = io_handle->time_budget;
+	progress_callback  = io_handle->progress_callback;
+	progress_user_data = io_handle->progress_user_data;
+	verify_hashes      = io_handle->verify_hashes;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -177,9 +192,122 @@ int libagdb_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->time_budget        = time_budget;
+	io_handle->progress_callback  = progress_callback;
+	io_handle->progress_user_data = progress_user_data;
+	io_handle->verify_hashes      = verify_hashes;
+
+	return( 1 );
+}
+
+/* Starts a new activity
+ * The deadline is set from the time budget. An abort that was signalled before is not
+ * cleared, since it can be signalled by another thread while the activity starts
+ * The time budget is in milliseconds, 0 represents no deadline
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_io_handle_start_activity(
+     libagdb_io_handle_t *io_handle,
+     uint64_t time_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_start_activity";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_budget > ( (uint64_t) UINT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time budget value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->deadline = 0;
+
+	if( time_budget > 0 )
+	{
+		io_handle->deadline = libagdb_statistics_get_timestamp() + ( time_budget * 1000000 );
+	}
 	return( 1 );
 }
 
+/* Checks if the current activity needs to be aborted
+ * The activity is aborted when abort was signalled or when the deadline has passed,
+ * in which case the error is set to abort requested
+ * This function does not modify the IO handle and is called by the decompression threads.
+ * The deadline is only changed while these threads are not running, which is ordered by
+ * creating and joining the thread pool. The abort value is set by libagdb_file_signal_abort
+ * without synchronization, so a thread can observe a signalled abort with a delay
+ * Returns 1 if the activity needs to be aborted or 0 if not
+ */
+int libagdb_io_handle_check_abort(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_check_abort";
+
+	if( io_handle == NULL )
+	{
+		return( 0 );
+	}
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( 1 );
+	}
+	if( ( io_handle->deadline != 0 )
+	 && ( libagdb_statistics_get_timestamp() >= io_handle->deadline ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: time budget exceeded.",
+		 function );
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reports the progress to the progress callback
+ * The current activity is aborted when the progress callback returns non-zero
+ */
+void libagdb_io_handle_report_progress(
+      libagdb_io_handle_t *io_handle )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->progress_callback == NULL ) )
+	{
+		return;
+	}
+	if( io_handle->progress_callback(
+	     &( io_handle->progress ),
+	     io_handle->progress_user_data ) != 0 )
+	{
+		io_handle->abort = 1;
+	}
+}
+
 /* Reads the compressed blocks
  * Returns 1 if successful or -1 on error
  */
@@ -189,11 +317,14 @@ int libagdb_io_handle_read_compressed_blocks(
      libfdata_list_t *compressed_blocks_list,
      libcerror_error_t **error )
 {
-	uint8_t compressed_block_data[ 4 ];
-
+	uint8_t *compressed_block_data   = NULL;
+	uint8_t *window_data             = NULL;
 	static char *function            = "libagdb_io_handle_read_compressed_blocks";
 	off64_t file_offset              = 0;
+	off64_t window_offset            = 0;
 	size_t read_size                 = 0;
+	size_t window_allocated_size     = 0;
+	size_t window_size               = 0;
 	ssize_t read_count               = 0;
 	uint32_t compressed_block_size   = 0;
 	uint32_t uncompressed_data_size  = 0;
@@ -212,9 +343,10 @@ int libagdb_io_handle_read_compressed_blocks(
 
 		return( -1 );
 	}
+	/* The MAM (Windows 8) compressed data is a single stream and is read by the MAM stream
+	 */
 	if( ( io_handle->file_type != LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
-	 && ( io_handle->file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
-	 && ( io_handle->file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 ) )
+	 && ( io_handle->file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -235,16 +367,99 @@ int libagdb_io_handle_read_compressed_blocks(
 		file_offset = 8;
 		read_size   = 4;
 	}
-	else if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 )
-	{
-/* TODO implement */
-		file_offset = 4;
-		read_size   = 4;
-	}
 	uncompressed_data_size = io_handle->uncompressed_data_size;
 
+	/* The block headers are read from windows of the file instead of one small read per block
+	 */
+	if( (size64_t) file_offset < io_handle->file_size )
+	{
+		window_allocated_size = LIBAGDB_COMPRESSED_BLOCKS_READ_WINDOW_SIZE;
+
+		if( (size64_t) window_allocated_size > ( io_handle->file_size - (size64_t) file_offset ) )
+		{
+			window_allocated_size = (size_t) ( io_handle->file_size - (size64_t) file_offset );
+		}
+		window_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * window_allocated_size );
+
+		if( window_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create window data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( (size64_t) file_offset < io_handle->file_size )
 	{
+		/* Only read a new window when the block header is not entirely inside the current window
+		 */
+		if( ( window_size == 0 )
+		 || ( file_offset < window_offset )
+		 || ( (size64_t) ( file_offset - window_offset ) > (size64_t) ( window_size - read_size ) ) )
+		{
+			if( libagdb_io_handle_check_abort(
+			     io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: unable to read compressed block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			window_size = window_allocated_size;
+
+			if( (size64_t) window_size > ( io_handle->file_size - (size64_t) file_offset ) )
+			{
+				window_size = (size_t) ( io_handle->file_size - (size64_t) file_offset );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading compressed data window at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+				 function,
+				 file_offset,
+				 file_offset,
+				 window_size );
+			}
+#endif
+			read_count = libagdb_statistics_read_buffer_at_offset(
+			              &( io_handle->statistics ),
+			              file_io_handle,
+			              window_data,
+			              window_size,
+			              file_offset,
+			              error );
+
+			if( ( read_count != (ssize_t) window_size )
+			 || ( window_size < read_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			window_offset = file_offset;
+		}
+		compressed_block_data = &( window_data[ file_offset - window_offset ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -255,26 +470,6 @@ int libagdb_io_handle_read_compressed_blocks(
 			 file_offset );
 		}
 #endif
-		read_count = libbfio_handle_read_buffer_at_offset(
-		              file_io_handle,
-		              compressed_block_data,
-		              read_size,
-		              file_offset,
-		              error );
-
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
-
-			return( -1 );
-		}
 		if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
 		{
 			byte_stream_copy_to_uint16_little_endian(
@@ -292,7 +487,7 @@ int libagdb_io_handle_read_compressed_blocks(
 				 "%s: invalid compressed block size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			compressed_block_size += 3;
 		}
@@ -304,10 +499,6 @@ int libagdb_io_handle_read_compressed_blocks(
 
 			file_offset += 4;
 		}
-		else if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8 )
-		{
-/* TODO implement read the block and determine the range */
-		}
 		if( uncompressed_data_size < io_handle->uncompressed_block_size )
 		{
 			uncompressed_block_size = uncompressed_data_size;
@@ -335,7 +526,7 @@ int libagdb_io_handle_read_compressed_blocks(
 			 "%s: invalid compressed block size value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libfdata_list_append_element_with_mapped_size(
 		     compressed_blocks_list,
@@ -355,7 +546,7 @@ int libagdb_io_handle_read_compressed_blocks(
 			 function,
 			 compressed_block_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		file_offset            += compressed_block_size;
 		uncompressed_data_size -= uncompressed_block_size;
@@ -379,7 +570,20 @@ int libagdb_io_handle_read_compressed_blocks(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	if( window_data != NULL )
+	{
+		memory_free(
+		 window_data );
+	}
 	return( 1 );
+
+on_error:
+	if( window_data != NULL )
+	{
+		memory_free(
+		 window_data );
+	}
+	return( -1 );
 }
 
 /* Reads the uncompressed file header
@@ -495,6 +699,9 @@ int libagdb_io_handle_read_uncompressed_file_header(
 
 		goto on_error;
 	}
+	io_handle->statistics.number_of_stream_reads += 1;
+	io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -616,6 +823,9 @@ int libagdb_io_handle_read_uncompressed_file_header(
 
 		goto on_error;
 	}
+	io_handle->statistics.number_of_stream_reads += 1;
+	io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -927,12 +1137,72 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a pointer to a range of the mapped uncompressed data
+ * Returns 1 if successful, 0 if the data is not mapped or -1 on error
+ */
+int libagdb_io_handle_get_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_get_mapped_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > (size64_t) io_handle->mapped_data_size )
+	 || ( size > ( io_handle->mapped_data_size - (size_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: invalid offset: %" PRIi64 " (0x%08" PRIx64 ") or size: %" PRIzd " value out of bounds.",
+		 function,
+		 offset,
+		 offset,
+		 size );
+
+		return( -1 );
+	}
+	*data = &( io_handle->mapped_data[ offset ] );
+
+	return( 1 );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the uncompressed block stream
+ * The data handle is optional, if set it contains the IO handle the read is added to the statistics of
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libagdb_io_handle_read_segment_data(
-         intptr_t *data_handle LIBAGDB_ATTRIBUTE_UNUSED,
+         intptr_t *data_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
@@ -942,10 +1212,11 @@ ssize_t libagdb_io_handle_read_segment_data(
          uint8_t read_flags LIBAGDB_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	static char *function = "libagdb_io_handle_read_segment_data";
-	ssize_t read_count    = 0;
+	libagdb_io_handle_t *io_handle = NULL;
+	static char *function          = "libagdb_io_handle_read_segment_data";
+	ssize_t read_count             = 0;
+	uint64_t timestamp             = 0;
 
-	LIBAGDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_flags )
 	LIBAGDB_UNREFERENCED_PARAMETER( read_flags )
@@ -961,6 +1232,12 @@ ssize_t libagdb_io_handle_read_segment_data(
 
 		return( -1 );
 	}
+	io_handle = (libagdb_io_handle_t *) data_handle;
+
+	if( io_handle != NULL )
+	{
+		timestamp = libagdb_statistics_get_timestamp();
+	}
 	read_count = libbfio_handle_read_buffer(
 	              (libbfio_handle_t *) file_io_handle,
 	              segment_data,
@@ -979,6 +1256,17 @@ ssize_t libagdb_io_handle_read_segment_data(
 
 		return( -1 );
 	}
+	if( io_handle != NULL )
+	{
+		io_handle->statistics.file_read_time       += libagdb_statistics_get_timestamp() - timestamp;
+		io_handle->statistics.number_of_file_reads += 1;
+		io_handle->statistics.file_read_size       += (uint64_t) read_count;
+
+		io_handle->progress.uncompressed_offset += (uint64_t) read_count;
+
+		libagdb_io_handle_report_progress(
+		 io_handle );
+	}
 	return( read_count );
 }
 
@@ -987,16 +1275,16 @@ ssize_t libagdb_io_handle_read_segment_data(
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libagdb_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBAGDB_ATTRIBUTE_UNUSED,
+         intptr_t *data_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
          libcerror_error_t **error )
 {
-	static char *function = "libagdb_io_handle_seek_segment_offset";
+	libagdb_io_handle_t *io_handle = NULL;
+	static char *function          = "libagdb_io_handle_seek_segment_offset";
 
-	LIBAGDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
 
 	if( libbfio_handle_seek_offset(
@@ -1016,6 +1304,14 @@ off64_t libagdb_io_handle_seek_segment_offset(
 
 		return( -1 );
 	}
+	io_handle = (libagdb_io_handle_t *) data_handle;
+
+	/* The uncompressed data is stored in a single segment at the start of the file
+	 */
+	if( io_handle != NULL )
+	{
+		io_handle->progress.uncompressed_offset = (uint64_t) segment_offset;
+	}
 	return( segment_offset );
 }
 
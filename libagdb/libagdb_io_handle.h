@@ -29,6 +29,8 @@
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_progress.h"
+#include "libagdb_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -82,9 +84,62 @@ struct libagdb_io_handle
 	 */
 	uint32_t file_information_sub_entry_type2_size;
 
+	/* The compressed block pool
+	 * The pool is referenced and freed by the file
+	 */
+	struct libagdb_compressed_block_pool *compressed_block_pool;
+
+	/* The uncompressed data when the file is mapped into memory
+	 * The data is referenced and unmapped by the file
+	 */
+	const uint8_t *mapped_data;
+
+	/* The size of the mapped data
+	 */
+	size_t mapped_data_size;
+
+	/* The data handle of the compressed blocks stream
+	 * The data handle is referenced and freed with the compressed blocks stream
+	 */
+	struct libagdb_compressed_blocks_stream_data_handle *compressed_blocks_data_handle;
+
+	/* The statistics
+	 */
+	libagdb_statistics_t statistics;
+
 	/* Value to indicate if abort was signalled
+	 * The value is only cleared when the file is opened or closed
 	 */
 	int abort;
+
+	/* The monotonic time stamp after which the current activity is aborted
+	 * 0 represents no deadline
+	 */
+	uint64_t deadline;
+
+	/* The time budget of an activity that is started on demand
+	 * The time budget is in milliseconds, 0 represents no time budget
+	 */
+	uint64_t time_budget;
+
+	/* The progress
+	 */
+	libagdb_progress_t progress;
+
+	/* The progress callback
+	 * NULL if no progress is reported
+	 */
+	int (*progress_callback)(
+	       const libagdb_progress_t *progress,
+	       void *user_data );
+
+	/* The progress callback user data
+	 */
+	void *progress_user_data;
+
+	/* Value to indicate if the stored hashes should be verified
+	 */
+	uint8_t verify_hashes;
 };
 
 int libagdb_io_handle_initialize(
@@ -99,6 +154,18 @@ int libagdb_io_handle_clear(
      libagdb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libagdb_io_handle_start_activity(
+     libagdb_io_handle_t *io_handle,
+     uint64_t time_budget,
+     libcerror_error_t **error );
+
+int libagdb_io_handle_check_abort(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+void libagdb_io_handle_report_progress(
+      libagdb_io_handle_t *io_handle );
+
 int libagdb_io_handle_read_compressed_blocks(
      libagdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -114,6 +181,13 @@ int libagdb_io_handle_read_uncompressed_file_header(
      uint32_t *number_of_sources,
      libcerror_error_t **error );
 
+int libagdb_io_handle_get_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 ssize_t libagdb_io_handle_read_segment_data(
          intptr_t *data_handle,
          intptr_t *file_io_handle,
@@ -0,0 +1,213 @@
+/*
+ * MAM decoder checkpoint functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_mam_checkpoint.h"
+
+/* Creates a MAM decoder checkpoint
+ * Make sure the value mam_checkpoint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_checkpoint_initialize(
+     libagdb_mam_checkpoint_t **mam_checkpoint,
+     off64_t input_offset,
+     size_t output_offset,
+     const uint8_t *window,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_checkpoint_initialize";
+
+	if( mam_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MAM checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid input offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*mam_checkpoint = memory_allocate_structure(
+	                   libagdb_mam_checkpoint_t );
+
+	if( *mam_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MAM checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mam_checkpoint,
+	     0,
+	     sizeof( libagdb_mam_checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MAM checkpoint.",
+		 function );
+
+		memory_free(
+		 *mam_checkpoint );
+
+		*mam_checkpoint = NULL;
+
+		return( -1 );
+	}
+	( *mam_checkpoint )->window = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * window_size );
+
+	if( ( *mam_checkpoint )->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *mam_checkpoint )->window,
+	     window,
+	     window_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy window.",
+		 function );
+
+		goto on_error;
+	}
+	( *mam_checkpoint )->input_offset  = input_offset;
+	( *mam_checkpoint )->output_offset = output_offset;
+
+	return( 1 );
+
+on_error:
+	if( *mam_checkpoint != NULL )
+	{
+		if( ( *mam_checkpoint )->window != NULL )
+		{
+			memory_free(
+			 ( *mam_checkpoint )->window );
+		}
+		memory_free(
+		 *mam_checkpoint );
+
+		*mam_checkpoint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a MAM decoder checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_checkpoint_free(
+     libagdb_mam_checkpoint_t **mam_checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_checkpoint_free";
+
+	if( mam_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_checkpoint != NULL )
+	{
+		memory_free(
+		 ( *mam_checkpoint )->window );
+
+		memory_free(
+		 *mam_checkpoint );
+
+		*mam_checkpoint = NULL;
+	}
+	return( 1 );
+}
+
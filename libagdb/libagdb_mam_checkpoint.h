@@ -0,0 +1,68 @@
+/*
+ * MAM decoder checkpoint functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_MAM_CHECKPOINT_H )
+#define _LIBAGDB_MAM_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_mam_checkpoint libagdb_mam_checkpoint_t;
+
+struct libagdb_mam_checkpoint
+{
+	/* The offset of the chunk header relative to the start of the compressed data
+	 */
+	off64_t input_offset;
+
+	/* The uncompressed offset of the start of the chunk
+	 */
+	size_t output_offset;
+
+	/* A copy of the sliding window at the start of the chunk
+	 */
+	uint8_t *window;
+};
+
+int libagdb_mam_checkpoint_initialize(
+     libagdb_mam_checkpoint_t **mam_checkpoint,
+     off64_t input_offset,
+     size_t output_offset,
+     const uint8_t *window,
+     size_t window_size,
+     libcerror_error_t **error );
+
+int libagdb_mam_checkpoint_free(
+     libagdb_mam_checkpoint_t **mam_checkpoint,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_MAM_CHECKPOINT_H ) */
+
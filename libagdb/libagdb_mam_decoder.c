@@ -0,0 +1,1313 @@
+/*
+ * MAM (LZXPRESS Huffman stream) decoder functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcnotify.h"
+#include "libagdb_mam_checkpoint.h"
+#include "libagdb_mam_decoder.h"
+#include "libagdb_statistics.h"
+
+/* Creates a MAM decoder
+ * A checkpoint is recorded at the first chunk that starts at least checkpoint interval bytes
+ * after the previous checkpoint, a checkpoint interval of 0 disables checkpoints
+ * Make sure the value mam_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_initialize(
+     libagdb_mam_decoder_t **mam_decoder,
+     off64_t compressed_data_offset,
+     size64_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t checkpoint_interval,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_decoder_initialize";
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MAM decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid compressed data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*mam_decoder = memory_allocate_structure(
+	                libagdb_mam_decoder_t );
+
+	if( *mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MAM decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mam_decoder,
+	     0,
+	     sizeof( libagdb_mam_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MAM decoder.",
+		 function );
+
+		memory_free(
+		 *mam_decoder );
+
+		*mam_decoder = NULL;
+
+		return( -1 );
+	}
+	( *mam_decoder )->input_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * LIBAGDB_MAM_DECODER_INPUT_BUFFER_SIZE );
+
+	if( ( *mam_decoder )->input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	( *mam_decoder )->decode_table = (uint16_t *) memory_allocate(
+	                                               sizeof( uint16_t ) * LIBAGDB_MAM_DECODER_DECODE_TABLE_SIZE );
+
+	if( ( *mam_decoder )->decode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decode table.",
+		 function );
+
+		goto on_error;
+	}
+	( *mam_decoder )->window = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * LIBAGDB_MAM_DECODER_WINDOW_SIZE );
+
+	if( ( *mam_decoder )->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *mam_decoder )->checkpoints_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoints array.",
+		 function );
+
+		goto on_error;
+	}
+	( *mam_decoder )->compressed_data_offset = compressed_data_offset;
+	( *mam_decoder )->compressed_data_size   = compressed_data_size;
+	( *mam_decoder )->uncompressed_data_size = uncompressed_data_size;
+	( *mam_decoder )->checkpoint_interval    = checkpoint_interval;
+	( *mam_decoder )->next_checkpoint_offset = checkpoint_interval;
+
+	return( 1 );
+
+on_error:
+	if( *mam_decoder != NULL )
+	{
+		if( ( *mam_decoder )->window != NULL )
+		{
+			memory_free(
+			 ( *mam_decoder )->window );
+		}
+		if( ( *mam_decoder )->decode_table != NULL )
+		{
+			memory_free(
+			 ( *mam_decoder )->decode_table );
+		}
+		if( ( *mam_decoder )->input_data != NULL )
+		{
+			memory_free(
+			 ( *mam_decoder )->input_data );
+		}
+		memory_free(
+		 *mam_decoder );
+
+		*mam_decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a MAM decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_free(
+     libagdb_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_decoder_free";
+	int result            = 1;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mam_decoder != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *mam_decoder )->checkpoints_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_mam_checkpoint_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free checkpoints array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *mam_decoder )->window );
+
+		memory_free(
+		 ( *mam_decoder )->decode_table );
+
+		memory_free(
+		 ( *mam_decoder )->input_data );
+
+		memory_free(
+		 *mam_decoder );
+
+		*mam_decoder = NULL;
+	}
+	return( result );
+}
+
+/* Resets a MAM decoder to the start of the compressed data
+ * The compressed input buffer and checkpoints are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_reset(
+     libagdb_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_decoder_reset";
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	mam_decoder->input_offset     = 0;
+	mam_decoder->next_bits        = 0;
+	mam_decoder->extra_bit_count  = 0;
+	mam_decoder->chunk_end_offset = 0;
+	mam_decoder->output_offset    = 0;
+	mam_decoder->match_length     = 0;
+	mam_decoder->match_offset     = 0;
+
+	return( 1 );
+}
+
+/* Appends a checkpoint of the decoder state at the start of the current chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_append_checkpoint(
+     libagdb_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error )
+{
+	libagdb_mam_checkpoint_t *mam_checkpoint = NULL;
+	static char *function                    = "libagdb_mam_decoder_append_checkpoint";
+	int entry_index                          = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( mam_decoder->match_length != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid MAM decoder - match length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_mam_checkpoint_initialize(
+	     &mam_checkpoint,
+	     mam_decoder->input_offset,
+	     mam_decoder->output_offset,
+	     mam_decoder->window,
+	     LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     mam_decoder->checkpoints_array,
+	     &entry_index,
+	     (intptr_t *) mam_checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append checkpoint to array.",
+		 function );
+
+		goto on_error;
+	}
+	mam_decoder->next_checkpoint_offset = mam_decoder->output_offset + mam_decoder->checkpoint_interval;
+
+	return( 1 );
+
+on_error:
+	if( mam_checkpoint != NULL )
+	{
+		libagdb_mam_checkpoint_free(
+		 &mam_checkpoint,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Restores the decoder state from the last checkpoint at or before a specific uncompressed offset
+ * The checkpoint is only restored if it is closer to the offset than the current decoder state
+ * Returns 1 if successful, 0 if no checkpoint was restored or -1 on error
+ */
+int libagdb_mam_decoder_restore_checkpoint(
+     libagdb_mam_decoder_t *mam_decoder,
+     size_t offset,
+     libcerror_error_t **error )
+{
+	libagdb_mam_checkpoint_t *mam_checkpoint = NULL;
+	static char *function                    = "libagdb_mam_decoder_restore_checkpoint";
+	int entry_index                          = 0;
+	int lower_entry_index                    = 0;
+	int number_of_entries                    = 0;
+	int upper_entry_index                    = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     mam_decoder->checkpoints_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checkpoints are stored in order of uncompressed offset
+	 */
+	lower_entry_index = 0;
+	upper_entry_index = number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     mam_decoder->checkpoints_array,
+		     entry_index,
+		     (intptr_t **) &mam_checkpoint,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checkpoint: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( mam_checkpoint == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing checkpoint: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( mam_checkpoint->output_offset <= offset )
+		{
+			lower_entry_index = entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = entry_index;
+		}
+	}
+	if( lower_entry_index == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     mam_decoder->checkpoints_array,
+	     lower_entry_index - 1,
+	     (intptr_t **) &mam_checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint: %d.",
+		 function,
+		 lower_entry_index - 1 );
+
+		return( -1 );
+	}
+	if( mam_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing checkpoint: %d.",
+		 function,
+		 lower_entry_index - 1 );
+
+		return( -1 );
+	}
+	/* Continue decoding from the current state if it is between the checkpoint and the offset
+	 */
+	if( ( mam_decoder->output_offset >= mam_checkpoint->output_offset )
+	 && ( mam_decoder->output_offset <= offset ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     mam_decoder->window,
+	     mam_checkpoint->window,
+	     LIBAGDB_MAM_DECODER_WINDOW_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy window.",
+		 function );
+
+		return( -1 );
+	}
+	/* Setting the chunk end offset to the output offset makes the decoder
+	 * read the chunk header at the checkpoint input offset
+	 */
+	mam_decoder->input_offset     = mam_checkpoint->input_offset;
+	mam_decoder->next_bits        = 0;
+	mam_decoder->extra_bit_count  = 0;
+	mam_decoder->output_offset    = mam_checkpoint->output_offset;
+	mam_decoder->chunk_end_offset = mam_checkpoint->output_offset;
+	mam_decoder->match_length     = 0;
+	mam_decoder->match_offset     = 0;
+
+	return( 1 );
+}
+
+/* Reads a byte from the compressed data
+ * Bytes beyond the end of the compressed data are read as 0
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_read_byte(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *value,
+     libcerror_error_t **error )
+{
+	libagdb_statistics_t *statistics = NULL;
+	static char *function            = "libagdb_mam_decoder_read_byte";
+	size64_t read_size               = 0;
+	ssize_t read_count               = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) mam_decoder->input_offset >= mam_decoder->compressed_data_size )
+	{
+		mam_decoder->input_offset += 1;
+
+		*value = 0;
+
+		return( 1 );
+	}
+	if( ( mam_decoder->input_offset < mam_decoder->input_data_offset )
+	 || ( mam_decoder->input_offset >= ( mam_decoder->input_data_offset + (off64_t) mam_decoder->input_data_size ) ) )
+	{
+		read_size = mam_decoder->compressed_data_size - (size64_t) mam_decoder->input_offset;
+
+		if( read_size > (size64_t) LIBAGDB_MAM_DECODER_INPUT_BUFFER_SIZE )
+		{
+			read_size = LIBAGDB_MAM_DECODER_INPUT_BUFFER_SIZE;
+		}
+		if( libagdb_io_handle_check_abort(
+		     mam_decoder->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 mam_decoder->compressed_data_offset + mam_decoder->input_offset,
+			 mam_decoder->compressed_data_offset + mam_decoder->input_offset );
+
+			return( -1 );
+		}
+		if( mam_decoder->io_handle != NULL )
+		{
+			statistics = &( mam_decoder->io_handle->statistics );
+		}
+		mam_decoder->input_data_offset = mam_decoder->input_offset;
+		mam_decoder->input_data_size   = 0;
+
+		read_count = libagdb_statistics_read_buffer_at_offset(
+		              statistics,
+		              file_io_handle,
+		              mam_decoder->input_data,
+		              (size_t) read_size,
+		              mam_decoder->compressed_data_offset + mam_decoder->input_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 mam_decoder->compressed_data_offset + mam_decoder->input_offset,
+			 mam_decoder->compressed_data_offset + mam_decoder->input_offset );
+
+			return( -1 );
+		}
+		mam_decoder->input_data_size = (size_t) read_size;
+	}
+	*value = mam_decoder->input_data[ mam_decoder->input_offset - mam_decoder->input_data_offset ];
+
+	mam_decoder->input_offset += 1;
+
+	return( 1 );
+}
+
+/* Reads bits from the compressed data
+ * The bits are consumed from the most significant bit of next bits,
+ * which is refilled with 16-bit little-endian values
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_read_bits(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     uint8_t number_of_bits,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_decoder_read_bits";
+	uint16_t value_16bit  = 0;
+	uint8_t byte_value    = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits == 0 )
+	{
+		*value = 0;
+
+		return( 1 );
+	}
+	*value = mam_decoder->next_bits >> ( 32 - number_of_bits );
+
+	mam_decoder->next_bits      <<= number_of_bits;
+	mam_decoder->extra_bit_count -= (int) number_of_bits;
+
+	if( mam_decoder->extra_bit_count < 0 )
+	{
+		if( libagdb_mam_decoder_read_byte(
+		     mam_decoder,
+		     file_io_handle,
+		     &byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read byte.",
+			 function );
+
+			return( -1 );
+		}
+		value_16bit = byte_value;
+
+		if( libagdb_mam_decoder_read_byte(
+		     mam_decoder,
+		     file_io_handle,
+		     &byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read byte.",
+			 function );
+
+			return( -1 );
+		}
+		value_16bit |= (uint16_t) byte_value << 8;
+
+		mam_decoder->next_bits       |= (uint32_t) value_16bit << ( -mam_decoder->extra_bit_count );
+		mam_decoder->extra_bit_count += 16;
+	}
+	return( 1 );
+}
+
+/* Reads the chunk header, which contains the Huffman code sizes, and builds the decode table
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_decoder_read_chunk_header(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ 512 ];
+	uint8_t bits_data[ 4 ];
+
+	static char *function    = "libagdb_mam_decoder_read_chunk_header";
+	size_t entry_index       = 0;
+	size_t number_of_entries = 0;
+	size_t table_index       = 0;
+	uint16_t symbol          = 0;
+	uint16_t value_16bit     = 0;
+	uint8_t byte_value       = 0;
+	uint8_t code_size        = 0;
+	int byte_index           = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < 256;
+	     byte_index++ )
+	{
+		if( libagdb_mam_decoder_read_byte(
+		     mam_decoder,
+		     file_io_handle,
+		     &byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read Huffman code sizes.",
+			 function );
+
+			return( -1 );
+		}
+		code_sizes[ 2 * byte_index ]         = byte_value & 0x0f;
+		code_sizes[ ( 2 * byte_index ) + 1 ] = byte_value >> 4;
+	}
+	/* The codes are assigned in order of code size and symbol value
+	 */
+	for( code_size = 1;
+	     code_size <= 15;
+	     code_size++ )
+	{
+		number_of_entries = (size_t) 1 << ( 15 - code_size );
+
+		for( symbol = 0;
+		     symbol < 512;
+		     symbol++ )
+		{
+			if( code_sizes[ symbol ] != code_size )
+			{
+				continue;
+			}
+			if( number_of_entries > ( LIBAGDB_MAM_DECODER_DECODE_TABLE_SIZE - table_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid Huffman code sizes - too many codes.",
+				 function );
+
+				return( -1 );
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				mam_decoder->decode_table[ table_index++ ] = ( symbol << 4 ) | code_size;
+			}
+		}
+	}
+	/* Entries without a code are marked by a code size of 0
+	 */
+	while( table_index < LIBAGDB_MAM_DECODER_DECODE_TABLE_SIZE )
+	{
+		mam_decoder->decode_table[ table_index++ ] = 0;
+	}
+	/* The bit stream starts with two 16-bit little-endian values
+	 */
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		if( libagdb_mam_decoder_read_byte(
+		     mam_decoder,
+		     file_io_handle,
+		     &( bits_data[ byte_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( bits_data[ 0 ] ),
+	 value_16bit );
+
+	mam_decoder->next_bits = (uint32_t) value_16bit << 16;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( bits_data[ 2 ] ),
+	 value_16bit );
+
+	mam_decoder->next_bits      |= value_16bit;
+	mam_decoder->extra_bit_count = 16;
+
+	mam_decoder->chunk_end_offset = mam_decoder->output_offset + LIBAGDB_MAM_DECODER_CHUNK_SIZE;
+
+	return( 1 );
+}
+
+/* Decodes data from the current output offset
+ * If data is NULL the decoded data is only retained in the window
+ * Returns the number of bytes decoded or -1 on error
+ */
+ssize_t libagdb_mam_decoder_read(
+         libagdb_mam_decoder_t *mam_decoder,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libagdb_mam_decoder_read";
+	size_t data_offset      = 0;
+	uint32_t value_32bit    = 0;
+	uint16_t decode_entry   = 0;
+	uint16_t symbol         = 0;
+	uint8_t byte_value      = 0;
+	uint8_t code_size       = 0;
+	uint8_t match_size_bits = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_offset < data_size )
+	    && ( mam_decoder->output_offset < mam_decoder->uncompressed_data_size ) )
+	{
+		if( mam_decoder->match_length > 0 )
+		{
+			byte_value = mam_decoder->window[ ( mam_decoder->output_offset - mam_decoder->match_offset ) % LIBAGDB_MAM_DECODER_WINDOW_SIZE ];
+
+			mam_decoder->match_length -= 1;
+		}
+		else
+		{
+			if( mam_decoder->output_offset >= mam_decoder->chunk_end_offset )
+			{
+				if( ( mam_decoder->checkpoint_interval > 0 )
+				 && ( mam_decoder->output_offset >= mam_decoder->next_checkpoint_offset ) )
+				{
+					if( libagdb_mam_decoder_append_checkpoint(
+					     mam_decoder,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append checkpoint at uncompressed offset: %" PRIzd ".",
+						 function,
+						 mam_decoder->output_offset );
+
+						return( -1 );
+					}
+				}
+				if( libagdb_mam_decoder_read_chunk_header(
+				     mam_decoder,
+				     file_io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read chunk header at uncompressed offset: %" PRIzd ".",
+					 function,
+					 mam_decoder->output_offset );
+
+					return( -1 );
+				}
+			}
+			decode_entry = mam_decoder->decode_table[ mam_decoder->next_bits >> 17 ];
+			code_size    = (uint8_t) ( decode_entry & 0x000f );
+			symbol       = decode_entry >> 4;
+
+			if( code_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: invalid Huffman code at uncompressed offset: %" PRIzd ".",
+				 function,
+				 mam_decoder->output_offset );
+
+				return( -1 );
+			}
+			if( libagdb_mam_decoder_read_bits(
+			     mam_decoder,
+			     file_io_handle,
+			     code_size,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read Huffman code.",
+				 function );
+
+				return( -1 );
+			}
+			if( symbol < 256 )
+			{
+				byte_value = (uint8_t) symbol;
+			}
+			else
+			{
+				/* The lower 4 bits of the match symbol contain the match length
+				 * and the upper 4 bits the number of match offset bits
+				 */
+				symbol                  -= 256;
+				mam_decoder->match_length = symbol & 0x000f;
+				match_size_bits           = (uint8_t) ( symbol >> 4 );
+
+				if( mam_decoder->match_length == 15 )
+				{
+					if( libagdb_mam_decoder_read_byte(
+					     mam_decoder,
+					     file_io_handle,
+					     &byte_value,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read match length.",
+						 function );
+
+						return( -1 );
+					}
+					mam_decoder->match_length = byte_value;
+
+					if( mam_decoder->match_length == 255 )
+					{
+						if( libagdb_mam_decoder_read_byte(
+						     mam_decoder,
+						     file_io_handle,
+						     &byte_value,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read match length.",
+							 function );
+
+							return( -1 );
+						}
+						mam_decoder->match_length = byte_value;
+
+						if( libagdb_mam_decoder_read_byte(
+						     mam_decoder,
+						     file_io_handle,
+						     &byte_value,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read match length.",
+							 function );
+
+							return( -1 );
+						}
+						mam_decoder->match_length |= (size_t) byte_value << 8;
+
+						if( mam_decoder->match_length < 15 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+							 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+							 "%s: invalid match length value out of bounds.",
+							 function );
+
+							return( -1 );
+						}
+						mam_decoder->match_length -= 15;
+					}
+					mam_decoder->match_length += 15;
+				}
+				mam_decoder->match_length += 3;
+
+				if( libagdb_mam_decoder_read_bits(
+				     mam_decoder,
+				     file_io_handle,
+				     match_size_bits,
+				     &value_32bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read match offset.",
+					 function );
+
+					return( -1 );
+				}
+				mam_decoder->match_offset = (size_t) value_32bit + ( (size_t) 1 << match_size_bits );
+
+				if( mam_decoder->match_offset > mam_decoder->output_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: invalid match offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				continue;
+			}
+		}
+		mam_decoder->window[ mam_decoder->output_offset % LIBAGDB_MAM_DECODER_WINDOW_SIZE ] = byte_value;
+
+		if( data != NULL )
+		{
+			data[ data_offset ] = byte_value;
+		}
+		data_offset                += 1;
+		mam_decoder->output_offset += 1;
+	}
+	mam_decoder->decoded_size += (uint64_t) data_offset;
+
+	return( (ssize_t) data_offset );
+}
+
+/* Decodes data at a specific uncompressed offset
+ * Data that is still in the window is copied from the window, otherwise decoding
+ * resumes from the nearest checkpoint or the start of the compressed data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libagdb_mam_decoder_read_at_offset(
+         libagdb_mam_decoder_t *mam_decoder,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_decoder_read_at_offset";
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	size_t window_offset  = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( mam_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= (size64_t) mam_decoder->uncompressed_data_size )
+	{
+		return( 0 );
+	}
+	if( (size_t) offset < mam_decoder->output_offset )
+	{
+		if( ( mam_decoder->output_offset - (size_t) offset ) <= LIBAGDB_MAM_DECODER_WINDOW_SIZE )
+		{
+			read_size = mam_decoder->output_offset - (size_t) offset;
+
+			if( read_size > data_size )
+			{
+				read_size = data_size;
+			}
+			while( data_offset < read_size )
+			{
+				window_offset = ( (size_t) offset + data_offset ) % LIBAGDB_MAM_DECODER_WINDOW_SIZE;
+
+				data[ data_offset++ ] = mam_decoder->window[ window_offset ];
+			}
+			offset += read_size;
+		}
+	}
+	if( data_offset < data_size )
+	{
+		result = libagdb_mam_decoder_restore_checkpoint(
+		          mam_decoder,
+		          (size_t) offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to restore checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( (size_t) offset < mam_decoder->output_offset ) )
+		{
+			if( libagdb_mam_decoder_reset(
+			     mam_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset MAM decoder.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( (size_t) offset > mam_decoder->output_offset )
+		{
+			read_size = (size_t) offset - mam_decoder->output_offset;
+
+			read_count = libagdb_mam_decoder_read(
+			              mam_decoder,
+			              file_io_handle,
+			              NULL,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to decode data up to offset: %" PRIi64 ".",
+				 function,
+				 offset );
+
+				return( -1 );
+			}
+		}
+		read_count = libagdb_mam_decoder_read(
+		              mam_decoder,
+		              file_io_handle,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to decode data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( (ssize_t) data_offset );
+}
+
@@ -0,0 +1,204 @@
+/*
+ * MAM (LZXPRESS Huffman stream) decoder functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_MAM_DECODER_H )
+#define _LIBAGDB_MAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the sliding window, which is the maximum match offset
+ */
+#define LIBAGDB_MAM_DECODER_WINDOW_SIZE		65536
+
+/* The number of uncompressed bytes after which the Huffman table is reset
+ */
+#define LIBAGDB_MAM_DECODER_CHUNK_SIZE		65536
+
+/* The size of the compressed input buffer
+ */
+#define LIBAGDB_MAM_DECODER_INPUT_BUFFER_SIZE	65536
+
+/* The number of entries of the Huffman decode table, which is indexed by 15 bits
+ */
+#define LIBAGDB_MAM_DECODER_DECODE_TABLE_SIZE	32768
+
+typedef struct libagdb_mam_decoder libagdb_mam_decoder_t;
+
+struct libagdb_mam_decoder
+{
+	/* The offset of the compressed data in the file
+	 */
+	off64_t compressed_data_offset;
+
+	/* The compressed data size
+	 */
+	size64_t compressed_data_size;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The compressed input buffer
+	 */
+	uint8_t *input_data;
+
+	/* The number of bytes in the compressed input buffer
+	 */
+	size_t input_data_size;
+
+	/* The offset of the compressed input buffer relative to the start of the compressed data
+	 */
+	off64_t input_data_offset;
+
+	/* The offset of the next compressed byte relative to the start of the compressed data
+	 */
+	off64_t input_offset;
+
+	/* The bits read ahead from the compressed data
+	 */
+	uint32_t next_bits;
+
+	/* The number of bits available in next bits in addition to the first 16 bits
+	 */
+	int extra_bit_count;
+
+	/* The Huffman decode table of the current chunk
+	 * Every entry contains the symbol in the upper 12 bits and the code size in the lower 4 bits
+	 */
+	uint16_t *decode_table;
+
+	/* The uncompressed offset at which the current chunk ends
+	 */
+	size_t chunk_end_offset;
+
+	/* The sliding window containing the most recent uncompressed data
+	 */
+	uint8_t *window;
+
+	/* The uncompressed offset of the next byte to decode
+	 */
+	size_t output_offset;
+
+	/* The total number of bytes decoded, including bytes decoded again after a reset
+	 */
+	uint64_t decoded_size;
+
+	/* The remaining length of the current match
+	 */
+	size_t match_length;
+
+	/* The offset of the current match
+	 */
+	size_t match_offset;
+
+	/* The minimum number of uncompressed bytes between checkpoints
+	 * 0 represents no checkpoints are recorded
+	 */
+	size_t checkpoint_interval;
+
+	/* The uncompressed offset from which the next checkpoint is recorded
+	 */
+	size_t next_checkpoint_offset;
+
+	/* The checkpoints array
+	 */
+	libcdata_array_t *checkpoints_array;
+
+	/* The IO handle, used to count the compressed data reads and to check for an abort
+	 * NULL if not set
+	 */
+	libagdb_io_handle_t *io_handle;
+};
+
+int libagdb_mam_decoder_initialize(
+     libagdb_mam_decoder_t **mam_decoder,
+     off64_t compressed_data_offset,
+     size64_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t checkpoint_interval,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_free(
+     libagdb_mam_decoder_t **mam_decoder,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_reset(
+     libagdb_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_append_checkpoint(
+     libagdb_mam_decoder_t *mam_decoder,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_restore_checkpoint(
+     libagdb_mam_decoder_t *mam_decoder,
+     size_t offset,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_read_byte(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *value,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_read_bits(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     uint8_t number_of_bits,
+     uint32_t *value,
+     libcerror_error_t **error );
+
+int libagdb_mam_decoder_read_chunk_header(
+     libagdb_mam_decoder_t *mam_decoder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libagdb_mam_decoder_read(
+         libagdb_mam_decoder_t *mam_decoder,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+ssize_t libagdb_mam_decoder_read_at_offset(
+         libagdb_mam_decoder_t *mam_decoder,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_MAM_DECODER_H ) */
+
@@ -0,0 +1,141 @@
+/*
+ * The MAM stream functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+#include "libagdb_mam_stream.h"
+#include "libagdb_mam_stream_data_handle.h"
+
+/* Creates a MAM stream
+ * The uncompressed data is decoded on demand by a forward-only decoder that
+ * records checkpoints to resume decoding from
+ * The IO handle is optional, if set the decoding of the MAM stream is added to its statistics
+ * and is stopped when an abort is signalled or the time budget is exceeded
+ * Make sure the value mam_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_stream_initialize(
+     libfdata_stream_t **mam_stream,
+     off64_t compressed_data_offset,
+     size64_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t checkpoint_interval,
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libagdb_mam_stream_data_handle_t *data_handle = NULL;
+	static char *function                         = "libagdb_mam_stream_initialize";
+	int segment_index                             = 0;
+
+	if( mam_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MAM stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_mam_stream_data_handle_initialize(
+	     &data_handle,
+	     compressed_data_offset,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     checkpoint_interval,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	data_handle->mam_decoder->io_handle = io_handle;
+
+	if( libfdata_stream_initialize(
+	     mam_stream,
+	     (intptr_t *) data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_mam_stream_data_handle_free,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_mam_stream_data_handle_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libagdb_mam_stream_data_handle_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	/* The stream is now responsible for freeing the data handle
+	 */
+	data_handle = NULL;
+
+	if( libfdata_stream_append_segment(
+	     *mam_stream,
+	     &segment_index,
+	     0,
+	     0,
+	     (size64_t) uncompressed_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append MAM stream segment: 0.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mam_stream != NULL )
+	{
+		libfdata_stream_free(
+		 mam_stream,
+		 NULL );
+	}
+	if( data_handle != NULL )
+	{
+		libagdb_mam_stream_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,50 @@
+/*
+ * The MAM stream functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_MAM_STREAM_H )
+#define _LIBAGDB_MAM_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libagdb_mam_stream_initialize(
+     libfdata_stream_t **mam_stream,
+     off64_t compressed_data_offset,
+     size64_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t checkpoint_interval,
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_MAM_STREAM_H ) */
+
@@ -0,0 +1,311 @@
+/*
+ * The MAM stream data handle functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_mam_decoder.h"
+#include "libagdb_mam_stream_data_handle.h"
+#include "libagdb_statistics.h"
+#include "libagdb_unused.h"
+
+/* Creates a data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_stream_data_handle_initialize(
+     libagdb_mam_stream_data_handle_t **data_handle,
+     off64_t compressed_data_offset,
+     size64_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t checkpoint_interval,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_stream_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libagdb_mam_stream_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libagdb_mam_stream_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+
+		return( -1 );
+	}
+	if( libagdb_mam_decoder_initialize(
+	     &( ( *data_handle )->mam_decoder ),
+	     compressed_data_offset,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     checkpoint_interval,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create MAM decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mam_stream_data_handle_free(
+     libagdb_mam_stream_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_stream_data_handle_free";
+	int result            = 1;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		if( libagdb_mam_decoder_free(
+		     &( ( *data_handle )->mam_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MAM decoder.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( result );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the MAM stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libagdb_mam_stream_data_handle_read_segment_data(
+         libagdb_mam_stream_data_handle_t *data_handle,
+         intptr_t *file_io_handle,
+         int segment_index LIBAGDB_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBAGDB_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBAGDB_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	libagdb_statistics_t *statistics = NULL;
+	static char *function            = "libagdb_mam_stream_data_handle_read_segment_data";
+	ssize_t read_count               = 0;
+	uint64_t decoded_size            = 0;
+	uint64_t file_read_time          = 0;
+	uint64_t timestamp               = 0;
+
+	LIBAGDB_UNREFERENCED_PARAMETER( segment_index )
+	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBAGDB_UNREFERENCED_PARAMETER( segment_flags )
+	LIBAGDB_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->mam_decoder->io_handle != NULL )
+	{
+		statistics = &( data_handle->mam_decoder->io_handle->statistics );
+
+		decoded_size   = data_handle->mam_decoder->decoded_size;
+		file_read_time = statistics->file_read_time;
+		timestamp      = libagdb_statistics_get_timestamp();
+	}
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              data_handle->mam_decoder,
+	              (libbfio_handle_t *) file_io_handle,
+	              data_handle->current_offset,
+	              segment_data,
+	              segment_data_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_handle->current_offset,
+		 data_handle->current_offset );
+
+		return( -1 );
+	}
+	/* Data that is copied from the window of the decoder is not accounted for as decompressed
+	 */
+	if( ( statistics != NULL )
+	 && ( data_handle->mam_decoder->decoded_size > decoded_size ) )
+	{
+		/* The time spent reading the compressed data is accounted for as file read time
+		 */
+		statistics->decompression_time += libagdb_statistics_get_timestamp() - timestamp
+		                                - ( statistics->file_read_time - file_read_time );
+		statistics->decompressed_size  += data_handle->mam_decoder->decoded_size - decoded_size;
+	}
+	data_handle->current_offset += read_count;
+
+	if( data_handle->mam_decoder->io_handle != NULL )
+	{
+		data_handle->mam_decoder->io_handle->progress.uncompressed_offset = (uint64_t) data_handle->current_offset;
+
+		libagdb_io_handle_report_progress(
+		 data_handle->mam_decoder->io_handle );
+	}
+	return( read_count );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the MAM stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libagdb_mam_stream_data_handle_seek_segment_offset(
+         libagdb_mam_stream_data_handle_t *data_handle,
+         intptr_t *file_io_handle LIBAGDB_ATTRIBUTE_UNUSED,
+         int segment_index LIBAGDB_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libagdb_mam_stream_data_handle_seek_segment_offset";
+
+	LIBAGDB_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBAGDB_UNREFERENCED_PARAMETER( segment_index )
+	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
@@ -0,0 +1,355 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libagdb_libcerror.h"
+#include "libagdb_mapped_file.h"
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define LIBAGDB_HAVE_MAPPED_FILE_SUPPORT
+#endif
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mapped_file_initialize(
+     libagdb_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                libagdb_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( libagdb_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mapped_file_free(
+     libagdb_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( libagdb_mapped_file_unmap(
+		     *mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Maps a file read-only into memory
+ * Returns 1 if successful, 0 if the file could not be mapped or -1 on error
+ */
+int libagdb_mapped_file_map(
+     libagdb_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBAGDB_HAVE_MAPPED_FILE_SUPPORT )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libagdb_mapped_file_map";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_MAPPED_FILE_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only regular files of a size that fits in memory are mapped
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		munmap(
+		 data,
+		 (size_t) file_statistics.st_size );
+
+		return( -1 );
+	}
+	mapped_file->data      = (uint8_t *) data;
+	mapped_file->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+
+on_error:
+	close(
+	 file_descriptor );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( LIBAGDB_HAVE_MAPPED_FILE_SUPPORT ) */
+}
+
+/* Unmaps a file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_mapped_file_unmap(
+     libagdb_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_mapped_file_unmap";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_MAPPED_FILE_SUPPORT )
+	if( mapped_file->data != NULL )
+	{
+		if( munmap(
+		     mapped_file->data,
+		     mapped_file->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	mapped_file->data      = NULL;
+	mapped_file->data_size = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,317 @@
+/*
+ * Path pool functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_path_pool.h"
+
+/* Creates a path pool
+ * Make sure the value path_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_pool_initialize(
+     libagdb_path_pool_t **path_pool,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_pool_initialize";
+
+	if( path_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*path_pool = memory_allocate_structure(
+	              libagdb_path_pool_t );
+
+	if( *path_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_pool,
+	     0,
+	     sizeof( libagdb_path_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_pool )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *path_pool != NULL )
+	{
+		memory_free(
+		 *path_pool );
+
+		*path_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path pool
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_pool_free(
+     libagdb_path_pool_t **path_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_pool_free";
+	int block_index       = 0;
+
+	if( path_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_pool != NULL )
+	{
+		if( ( *path_pool )->blocks != NULL )
+		{
+			for( block_index = 0;
+			     block_index < ( *path_pool )->number_of_blocks;
+			     block_index++ )
+			{
+				memory_free(
+				 ( *path_pool )->blocks[ block_index ] );
+			}
+			memory_free(
+			 ( *path_pool )->blocks );
+		}
+		memory_free(
+		 *path_pool );
+
+		*path_pool = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends data to the path pool
+ * The data is stored in the last block if it fits, otherwise a new block is added to the pool.
+ * Data that is larger than the block size is stored in a block of its own.
+ * The pooled data remains valid until the path pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_pool_append(
+     libagdb_path_pool_t *path_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t **pooled_data,
+     libcerror_error_t **error )
+{
+	uint8_t **reallocation = NULL;
+	uint8_t *block         = NULL;
+	static char *function  = "libagdb_path_pool_append";
+	size_t block_size      = 0;
+	int number_of_blocks   = 0;
+
+	if( path_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_pool->number_of_blocks == 0 )
+	 || ( data_size > ( path_pool->last_block_size - path_pool->last_block_used_size ) ) )
+	{
+		if( path_pool->number_of_blocks >= path_pool->number_of_allocated_blocks )
+		{
+			number_of_blocks = path_pool->number_of_allocated_blocks;
+
+			if( number_of_blocks == 0 )
+			{
+				number_of_blocks = 16;
+			}
+			else if( number_of_blocks < ( INT_MAX / 2 ) )
+			{
+				number_of_blocks *= 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of blocks value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (uint8_t **) memory_reallocate(
+			                             path_pool->blocks,
+			                             sizeof( uint8_t * ) * number_of_blocks );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize blocks.",
+				 function );
+
+				return( -1 );
+			}
+			path_pool->blocks                     = reallocation;
+			path_pool->number_of_allocated_blocks = number_of_blocks;
+		}
+		block_size = path_pool->block_size;
+
+		if( data_size > block_size )
+		{
+			block_size = data_size;
+		}
+		block = (uint8_t *) memory_allocate(
+		                     sizeof( uint8_t ) * block_size );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			return( -1 );
+		}
+		path_pool->blocks[ path_pool->number_of_blocks ] = block;
+
+		path_pool->number_of_blocks    += 1;
+		path_pool->last_block_size      = block_size;
+		path_pool->last_block_used_size = 0;
+	}
+	block = &( path_pool->blocks[ path_pool->number_of_blocks - 1 ][ path_pool->last_block_used_size ] );
+
+	if( memory_copy(
+	     block,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	path_pool->last_block_used_size += data_size;
+	path_pool->data_size            += data_size;
+
+	*pooled_data = block;
+
+	return( 1 );
+}
+
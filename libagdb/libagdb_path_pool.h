@@ -0,0 +1,92 @@
+/*
+ * Path pool functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_PATH_POOL_H )
+#define _LIBAGDB_PATH_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of the blocks of the path pool
+ */
+#define LIBAGDB_PATH_POOL_BLOCK_SIZE	65536
+
+typedef struct libagdb_path_pool libagdb_path_pool_t;
+
+struct libagdb_path_pool
+{
+	/* The blocks
+	 */
+	uint8_t **blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of allocated block entries
+	 */
+	int number_of_allocated_blocks;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The size of the last block
+	 */
+	size_t last_block_size;
+
+	/* The used size of the last block
+	 */
+	size_t last_block_used_size;
+
+	/* The size of the data stored in the pool
+	 */
+	size64_t data_size;
+};
+
+int libagdb_path_pool_initialize(
+     libagdb_path_pool_t **path_pool,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libagdb_path_pool_free(
+     libagdb_path_pool_t **path_pool,
+     libcerror_error_t **error );
+
+int libagdb_path_pool_append(
+     libagdb_path_pool_t *path_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t **pooled_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_PATH_POOL_H ) */
+
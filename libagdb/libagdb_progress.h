@@ -0,0 +1,88 @@
+/*
+ * The progress definitions for libagdb
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_INTERNAL_PROGRESS_H )
+#define _LIBAGDB_INTERNAL_PROGRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Define HAVE_LOCAL_LIBAGDB for local use of libagdb
+ * The definitions in <libagdb/progress.h> are copied here
+ * for local use of libagdb
+ */
+#if !defined( HAVE_LOCAL_LIBAGDB )
+
+#include <libagdb/progress.h>
+
+#else
+
+/* The progress of an open, scan or read of the volume and source information records
+ */
+typedef struct libagdb_progress libagdb_progress_t;
+
+struct libagdb_progress
+{
+	/* The offset in the uncompressed data up to which the data was read
+	 */
+	uint64_t uncompressed_offset;
+
+	/* The uncompressed data size
+	 */
+	uint64_t uncompressed_data_size;
+
+	/* The number of parsed volume information records
+	 */
+	uint32_t number_of_parsed_volumes;
+
+	/* The number of volume information records
+	 */
+	uint32_t number_of_volumes;
+
+	/* The number of parsed file information records of the current volume
+	 */
+	uint32_t number_of_parsed_files;
+
+	/* The number of file information records of the current volume
+	 */
+	uint32_t number_of_files;
+
+	/* The number of parsed source information records
+	 */
+	uint32_t number_of_parsed_sources;
+
+	/* The number of source information records
+	 */
+	uint32_t number_of_sources;
+};
+
+#endif /* !defined( HAVE_LOCAL_LIBAGDB ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_INTERNAL_PROGRESS_H ) */
+
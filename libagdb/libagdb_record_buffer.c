@@ -0,0 +1,400 @@
+/*
+ * Record buffer functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compressed_blocks_stream_data_handle.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+#include "libagdb_record_buffer.h"
+
+/* Creates a record buffer
+ * Make sure the value record_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_record_buffer_initialize(
+     libagdb_record_buffer_t **record_buffer,
+     size_t span_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_record_buffer_initialize";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( span_size == 0 )
+	 || ( span_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid span size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*record_buffer = memory_allocate_structure(
+	                  libagdb_record_buffer_t );
+
+	if( *record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_buffer,
+	     0,
+	     sizeof( libagdb_record_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record buffer.",
+		 function );
+
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+
+		return( -1 );
+	}
+	( *record_buffer )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * span_size );
+
+	if( ( *record_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_buffer )->allocated_size = span_size;
+
+	return( 1 );
+
+on_error:
+	if( *record_buffer != NULL )
+	{
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_record_buffer_free(
+     libagdb_record_buffer_t **record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_record_buffer_free";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		if( ( *record_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *record_buffer )->data );
+		}
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a record
+ * If the uncompressed data is mapped into memory the data references the mapped data,
+ * if the record is stored in a single compressed block the data references the uncompressed block data,
+ * otherwise a span of the data stream that contains the record is read into the buffer.
+ * The data is valid until the next call to this function
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_record_buffer_get_data(
+     libagdb_record_buffer_t *record_buffer,
+     libagdb_io_handle_t *io_handle,
+     libfdata_stream_t *data_stream,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	const uint8_t *block_data = NULL;
+	uint8_t *reallocation     = NULL;
+	static char *function     = "libagdb_record_buffer_get_data";
+	size64_t stream_size      = 0;
+	size_t block_data_size    = 0;
+	size_t data_offset        = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		return( libagdb_io_handle_get_mapped_data(
+		         io_handle,
+		         offset,
+		         size,
+		         data,
+		         error ) );
+	}
+	if( ( record_buffer->data_size > 0 )
+	 && ( offset >= record_buffer->data_offset )
+	 && ( (size64_t) ( offset - record_buffer->data_offset ) <= (size64_t) record_buffer->data_size ) )
+	{
+		data_offset = (size_t) ( offset - record_buffer->data_offset );
+
+		if( size <= ( record_buffer->data_size - data_offset ) )
+		{
+			*data = &( ( record_buffer->data )[ data_offset ] );
+
+			return( 1 );
+		}
+	}
+	if( io_handle->compressed_blocks_data_handle != NULL )
+	{
+		if( libagdb_compressed_blocks_stream_data_handle_get_data(
+		     io_handle->compressed_blocks_data_handle,
+		     file_io_handle,
+		     offset,
+		     &block_data,
+		     &block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		/* Only a record that straddles a compressed block boundary is copied into the buffer
+		 */
+		if( size <= block_data_size )
+		{
+			*data = block_data;
+
+			return( 1 );
+		}
+	}
+	/* The record is not or only partially in the buffered span, read the span that starts at the record
+	 */
+	if( libfdata_stream_get_size(
+	     data_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) offset >= stream_size )
+	 || ( (size64_t) size > ( stream_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " (0x%08" PRIx64 ") or size: %" PRIzd " value out of bounds.",
+		 function,
+		 offset,
+		 offset,
+		 size );
+
+		return( -1 );
+	}
+	if( size > record_buffer->allocated_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            record_buffer->data,
+		                            sizeof( uint8_t ) * size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		record_buffer->data           = reallocation;
+		record_buffer->allocated_size = size;
+	}
+	read_size = record_buffer->allocated_size;
+
+	if( (size64_t) read_size > ( stream_size - (size64_t) offset ) )
+	{
+		read_size = (size_t) ( stream_size - (size64_t) offset );
+	}
+	record_buffer->data_size = 0;
+
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              data_stream,
+	              (intptr_t *) file_io_handle,
+	              record_buffer->data,
+	              read_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read span at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	io_handle->statistics.number_of_stream_reads += 1;
+	io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
+	record_buffer->data_offset = offset;
+	record_buffer->data_size   = read_size;
+
+	*data = record_buffer->data;
+
+	return( 1 );
+}
+
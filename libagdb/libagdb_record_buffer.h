@@ -0,0 +1,82 @@
+/*
+ * Record buffer functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_RECORD_BUFFER_H )
+#define _LIBAGDB_RECORD_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_record_buffer libagdb_record_buffer_t;
+
+struct libagdb_record_buffer
+{
+	/* The buffered span of the uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The size of the allocated data
+	 */
+	size_t allocated_size;
+
+	/* The offset of the buffered span
+	 */
+	off64_t data_offset;
+
+	/* The size of the buffered span
+	 */
+	size_t data_size;
+};
+
+int libagdb_record_buffer_initialize(
+     libagdb_record_buffer_t **record_buffer,
+     size_t span_size,
+     libcerror_error_t **error );
+
+int libagdb_record_buffer_free(
+     libagdb_record_buffer_t **record_buffer,
+     libcerror_error_t **error );
+
+int libagdb_record_buffer_get_data(
+     libagdb_record_buffer_t *record_buffer,
+     libagdb_io_handle_t *io_handle,
+     libfdata_stream_t *data_stream,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_RECORD_BUFFER_H ) */
+
@@ -183,6 +183,7 @@ ssize_t libagdb_source_information_read(
 {
 	uint8_t sub_entry_data[ 32 ];
 
+	const uint8_t *mapped_data       = NULL;
 	uint8_t *source_information_data = NULL;
 	static char *function            = "libagdb_source_information_read";
 	ssize_t read_count               = 0;
@@ -190,6 +191,7 @@ ssize_t libagdb_source_information_read(
 	uint32_t entry_index             = 0;
 	uint32_t number_of_entries       = 0;
 	uint32_t sub_entry_data_size     = 0;
+	int result                       = 0;
 
 	if( internal_source_information == NULL )
 	{
@@ -225,20 +227,6 @@ ssize_t libagdb_source_information_read(
 
 		return( -1 );
 	}
-	source_information_data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * (size_t) io_handle->source_information_entry_size );
-
-	if( source_information_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create source information data.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -250,22 +238,20 @@ ssize_t libagdb_source_information_read(
 		 file_offset );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              source_information_data,
-	              (size_t) io_handle->source_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->source_information_entry_size )
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          (size_t) io_handle->source_information_entry_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read source: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to retrieve source: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 source_information_index,
 		 file_offset,
@@ -273,12 +259,57 @@ ssize_t libagdb_source_information_read(
 
 		goto on_error;
 	}
-	total_read_count += read_count;
+	else if( result == 0 )
+	{
+		source_information_data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * (size_t) io_handle->source_information_entry_size );
+
+		if( source_information_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source information data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              uncompressed_data_stream,
+		              (intptr_t *) file_io_handle,
+		              source_information_data,
+		              (size_t) io_handle->source_information_entry_size,
+		              file_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->source_information_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 source_information_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		io_handle->statistics.number_of_stream_reads += 1;
+		io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
+		mapped_data = source_information_data;
+	}
+	total_read_count += (ssize_t) io_handle->source_information_entry_size;
+	file_offset      += (off64_t) io_handle->source_information_entry_size;
 
 	if( libagdb_source_information_read_data(
 	     internal_source_information,
 	     io_handle,
-	     source_information_data,
+	     mapped_data,
 	     (size_t) io_handle->source_information_entry_size,
 	     &number_of_entries,
 	     error ) != 1 )
@@ -293,11 +324,13 @@ ssize_t libagdb_source_information_read(
 
 		goto on_error;
 	}
-	memory_free(
-	 source_information_data );
-
-	source_information_data = NULL;
+	if( source_information_data != NULL )
+	{
+		memory_free(
+		 source_information_data );
 
+		source_information_data = NULL;
+	}
 	if( number_of_entries > 0 )
 	{
 /* TODO is this the correct sub entry type ? */
@@ -320,28 +353,68 @@ ssize_t libagdb_source_information_read(
 		     entry_index < number_of_entries;
 		     entry_index++ )
 		{
-			read_count = libfdata_stream_read_buffer(
-				      uncompressed_data_stream,
-				      (intptr_t *) file_io_handle,
-				      sub_entry_data,
-				      (size_t) sub_entry_data_size,
-				      0,
-				      error );
-
-			if( read_count != (ssize_t) sub_entry_data_size )
+			if( libagdb_io_handle_check_abort(
+			     io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: unable to read sub entry: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			result = libagdb_io_handle_get_mapped_data(
+			          io_handle,
+			          file_offset,
+			          (size_t) sub_entry_data_size,
+			          &mapped_data,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub entry: %" PRIu32 " data.",
+				 "%s: unable to retrieve sub entry: %" PRIu32 " data.",
 				 function,
 				 entry_index );
 
 				goto on_error;
 			}
-			total_read_count += read_count;
-			file_offset      += read_count;
+			else if( result == 0 )
+			{
+				read_count = libfdata_stream_read_buffer(
+					      uncompressed_data_stream,
+					      (intptr_t *) file_io_handle,
+					      sub_entry_data,
+					      (size_t) sub_entry_data_size,
+					      0,
+					      error );
+
+				if( read_count != (ssize_t) sub_entry_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub entry: %" PRIu32 " data.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				io_handle->statistics.number_of_stream_reads += 1;
+				io_handle->statistics.stream_read_size       += (uint64_t) read_count;
+
+				mapped_data = sub_entry_data;
+			}
+			total_read_count += (ssize_t) sub_entry_data_size;
+			file_offset      += (off64_t) sub_entry_data_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -351,7 +424,7 @@ ssize_t libagdb_source_information_read(
 				 function,
 				 entry_index );
 				libcnotify_print_data(
-				 sub_entry_data,
+				 mapped_data,
 				 (size_t) sub_entry_data_size,
 				 0 );
 			}
@@ -491,6 +564,20 @@ int libagdb_source_information_read_data(
 
 		return( -1 );
 	}
+	/* Only the lower 32-bit of the 64-bit name hash are used
+	 */
+	if( mode == 32 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (agdb_source_information_60_t *) data )->name_hash,
+		 internal_source_information->name_hash );
+	}
+	else if( mode == 64 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (agdb_source_information_88_t *) data )->name_hash,
+		 internal_source_information->name_hash );
+	}
 	if( ( io_handle->source_information_entry_size == 60 )
 	 || ( io_handle->source_information_entry_size == 88 ) )
 	{
@@ -745,6 +832,22 @@ int libagdb_source_information_read_data(
 		}
 		internal_source_information->executable_filename_size = string_index + 1;
 
+		/* Only the lower 32-bit of the 64-bit prefetch hash are used
+		 */
+		if( mode == 32 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (agdb_source_information_100_t *) data )->prefetch_hash,
+			 internal_source_information->prefetch_hash );
+		}
+		else if( mode == 64 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (agdb_source_information_144_t *) data )->prefetch_hash,
+			 internal_source_information->prefetch_hash );
+		}
+		internal_source_information->prefetch_hash_is_set = 1;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1030,6 +1133,93 @@ int libagdb_source_information_read_data(
 		}
 #endif
 	}
+	io_handle->statistics.number_of_parsed_records += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the name hash
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_source_information_get_name_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	static char *function                                              = "libagdb_source_information_get_name_hash";
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_information = (libagdb_internal_source_information_t *) source_information;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	*name_hash = internal_source_information->name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the prefetch hash
+ * The prefetch hash is only available in the 100 and 144 byte source information entries
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libagdb_source_information_get_prefetch_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	static char *function                                              = "libagdb_source_information_get_prefetch_hash";
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_information = (libagdb_internal_source_information_t *) source_information;
+
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_information->prefetch_hash_is_set == 0 )
+	{
+		return( 0 );
+	}
+	*prefetch_hash = internal_source_information->prefetch_hash;
+
 	return( 1 );
 }
 
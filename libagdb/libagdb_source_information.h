@@ -48,6 +48,18 @@ struct libagdb_internal_source_information
 	/* The executable filename size
 	 */
 	uint32_t executable_filename_size;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* Value to indicate the prefetch hash is set
+	 */
+	uint8_t prefetch_hash_is_set;
 };
 
 int libagdb_source_information_initialize(
@@ -80,6 +92,18 @@ int libagdb_source_information_read_data(
      uint32_t *number_of_entries,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_source_information_get_name_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_source_information_get_prefetch_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_source_information_get_utf8_executable_filename_size(
      libagdb_source_information_t *source_information,
@@ -0,0 +1,127 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include <time.h>
+
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_statistics.h"
+
+/* Retrieves a monotonic time stamp
+ * The time stamp is in nanoseconds and only meaningful relative to another time stamp
+ * Returns the time stamp or 0 if not available
+ */
+uint64_t libagdb_statistics_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#endif
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#else
+	return( (uint64_t) time(
+	                    NULL ) * 1000000000UL );
+#endif
+}
+
+/* Retrieves a time stamp from which the file read and decompression time is excluded
+ * The difference between two parse time stamps is the time spent parsing in between
+ * Returns the time stamp
+ */
+uint64_t libagdb_statistics_get_parse_timestamp(
+          libagdb_statistics_t *statistics )
+{
+	uint64_t timestamp = libagdb_statistics_get_timestamp();
+
+	if( statistics != NULL )
+	{
+		/* The subtraction can wrap around, which cancels out in the difference
+		 */
+		timestamp -= statistics->file_read_time + statistics->decompression_time;
+	}
+	return( timestamp );
+}
+
+/* Reads a buffer from the file at a specific offset
+ * The number of reads, the number of bytes read and the read time are added to the statistics
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libagdb_statistics_read_buffer_at_offset(
+         libagdb_statistics_t *statistics,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint64_t timestamp = 0;
+	ssize_t read_count = 0;
+
+	if( statistics != NULL )
+	{
+		timestamp = libagdb_statistics_get_timestamp();
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( statistics != NULL )
+	{
+		statistics->number_of_file_reads += 1;
+		statistics->file_read_time       += libagdb_statistics_get_timestamp() - timestamp;
+
+		if( read_count > 0 )
+		{
+			statistics->file_read_size += (uint64_t) read_count;
+		}
+	}
+	return( read_count );
+}
+
@@ -37,6 +37,8 @@
 #include "libagdb_libfdatetime.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libuna.h"
+#include "libagdb_path_pool.h"
+#include "libagdb_record_buffer.h"
 #include "libagdb_volume_information.h"
 
 #include "agdb_volume_information.h"
@@ -179,11 +181,70 @@ int libagdb_internal_volume_information_free(
 	}
 	if( *internal_volume_information != NULL )
 	{
-		if( ( *internal_volume_information )->device_path != NULL )
+		if( ( ( *internal_volume_information )->device_path != NULL )
+		 && ( ( *internal_volume_information )->device_path_is_referenced == 0 ) )
 		{
 			memory_free(
 			 ( *internal_volume_information )->device_path );
 		}
+		if( ( *internal_volume_information )->file_table != NULL )
+		{
+			if( libagdb_file_table_free(
+			     &( ( *internal_volume_information )->file_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_volume_information )->file_hash_table != NULL )
+		{
+			memory_free(
+			 ( *internal_volume_information )->file_hash_table );
+		}
+		if( ( *internal_volume_information )->record_buffer != NULL )
+		{
+			if( libagdb_record_buffer_free(
+			     &( ( *internal_volume_information )->record_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_volume_information )->sub_entries_data != NULL )
+		{
+			memory_free(
+			 ( *internal_volume_information )->sub_entries_data );
+		}
+		if( ( *internal_volume_information )->path_pool != NULL )
+		{
+			if( libagdb_path_pool_free(
+			     &( ( *internal_volume_information )->path_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( ( *internal_volume_information )->files_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_file_information_free,
@@ -518,6 +579,8 @@ int libagdb_internal_volume_information_read_data(
 		internal_volume_information->device_path_size += 1;
 		internal_volume_information->device_path_size *= 2;
 	}
+	io_handle->statistics.number_of_parsed_records += 1;
+
 	return( 1 );
 }
 
@@ -647,10 +710,11 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the volume information
+/* Reads the volume information entry and device path
+ * The file information records that follow are not read
  * Returns the number of bytes read if successful or -1 on error
  */
-ssize64_t libagdb_internal_volume_information_read_file_io_handle(
+ssize64_t libagdb_internal_volume_information_read_header_file_io_handle(
            libagdb_internal_volume_information_t *internal_volume_information,
            libagdb_io_handle_t *io_handle,
            libfdata_stream_t *data_stream,
@@ -659,18 +723,15 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
            uint32_t volume_index,
            libcerror_error_t **error )
 {
-	uint8_t alignment_padding_data[ 8 ];
-
-	libagdb_file_information_t *file_information = NULL;
-	uint8_t *volume_information_data             = NULL;
-	static char *function                        = "libagdb_internal_volume_information_read_file_io_handle";
-	ssize64_t total_read_count                   = 0;
-	size_t alignment_padding_size                = 0;
-	size_t alignment_size                        = 0;
-	ssize_t read_count                           = 0;
-	uint32_t calculated_hash_value               = 0;
-	uint32_t file_index                          = 0;
-	int entry_index                              = 0;
+	const uint8_t *record_data     = NULL;
+	static char *function          = "libagdb_internal_volume_information_read_header_file_io_handle";
+	ssize64_t total_read_count     = 0;
+	size_t alignment_padding_size  = 0;
+	size_t alignment_size          = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t calculated_hash_value = 0;
+#endif
 
 	if( internal_volume_information == NULL )
 	{
@@ -728,31 +789,34 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	volume_information_data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * (size_t) io_handle->volume_information_entry_size );
-
-	if( volume_information_data == NULL )
+	/* The records are retrieved from spans of the data stream that are read at once
+	 */
+	if( internal_volume_information->record_buffer == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create volume: %" PRIu32 " information data.",
-		 function,
-		 volume_index );
+		if( libagdb_record_buffer_initialize(
+		     &( internal_volume_information->record_buffer ),
+		     LIBAGDB_RECORD_BUFFER_SPAN_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record buffer.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              data_stream,
-	              (intptr_t *) file_io_handle,
-	              volume_information_data,
-	              (size_t) io_handle->volume_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->volume_information_entry_size )
+	if( libagdb_record_buffer_get_data(
+	     internal_volume_information->record_buffer,
+	     io_handle,
+	     data_stream,
+	     file_io_handle,
+	     file_offset,
+	     (size_t) io_handle->volume_information_entry_size,
+	     &record_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -766,13 +830,13 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	total_read_count += read_count;
-	file_offset      += read_count;
+	total_read_count += (ssize64_t) io_handle->volume_information_entry_size;
+	file_offset      += (off64_t) io_handle->volume_information_entry_size;
 
 	if( libagdb_internal_volume_information_read_data(
 	     internal_volume_information,
 	     io_handle,
-	     volume_information_data,
+	     record_data,
 	     (size_t) io_handle->volume_information_entry_size,
 	     error ) != 1 )
 	{
@@ -786,11 +850,6 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 volume_information_data );
-
-	volume_information_data = NULL;
-
 	if( io_handle->volume_information_entry_size == 56 )
 	{
 		alignment_size = 4;
@@ -824,42 +883,66 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 			goto on_error;
 		}
-		internal_volume_information->device_path = (uint8_t *) memory_allocate(
-		                                                        sizeof( uint8_t ) * internal_volume_information->device_path_size );
-
-		if( internal_volume_information->device_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create device path.",
-			 function );
-
-			goto on_error;
-		}
-		read_count = libfdata_stream_read_buffer(
-		              data_stream,
-		              (intptr_t *) file_io_handle,
-		              internal_volume_information->device_path,
-		              internal_volume_information->device_path_size,
-		              0,
-		              error );
-
-		if( read_count != (ssize_t) internal_volume_information->device_path_size )
+		if( libagdb_record_buffer_get_data(
+		     internal_volume_information->record_buffer,
+		     io_handle,
+		     data_stream,
+		     file_io_handle,
+		     file_offset,
+		     (size_t) internal_volume_information->device_path_size,
+		     &record_data,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volume: %" PRIu32 " information data.",
+			 "%s: unable to read volume: %" PRIu32 " device path data.",
 			 function,
 			 volume_index );
 
 			goto on_error;
 		}
-		total_read_count += read_count;
-		file_offset      += read_count;
+		if( io_handle->mapped_data != NULL )
+		{
+			/* The mapped data outlives the volume information
+			 */
+			internal_volume_information->device_path               = (uint8_t *) record_data;
+			internal_volume_information->device_path_is_referenced = 1;
+		}
+		else
+		{
+			internal_volume_information->device_path = (uint8_t *) memory_allocate(
+			                                                        sizeof( uint8_t ) * internal_volume_information->device_path_size );
+
+			if( internal_volume_information->device_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create device path.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     internal_volume_information->device_path,
+			     record_data,
+			     internal_volume_information->device_path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy device path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		total_read_count += (ssize64_t) internal_volume_information->device_path_size;
+		file_offset      += (off64_t) internal_volume_information->device_path_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -874,25 +957,28 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 			 0 );
 		}
 #endif
-		if( libagdb_hash_calculate(
-		     &calculated_hash_value,
-		     internal_volume_information->device_path,
-		     internal_volume_information->device_path_size - 2,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume: %" PRIu32 " device path hash value.",
-			 function,
-			 volume_index );
-
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
+			if( libagdb_hash_calculate(
+			     &calculated_hash_value,
+			     internal_volume_information->device_path,
+			     internal_volume_information->device_path_size - 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %" PRIu32 " device path hash value.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			io_handle->statistics.number_of_hash_calculations += 1;
+			io_handle->statistics.hashed_size                 += internal_volume_information->device_path_size - 2;
+
 			if( libagdb_debug_print_utf16_string_value(
 			     function,
 			     "volume device path\t\t\t",
@@ -935,142 +1021,47 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 				 alignment_padding_size );
 			}
 #endif
-			read_count = libfdata_stream_read_buffer(
-			              data_stream,
-			              (intptr_t *) file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) alignment_padding_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file: %" PRIu32 " alignment padding data.",
-				 function,
-				 file_index );
-
-				goto on_error;
-			}
-			total_read_count += read_count;
-			file_offset      += read_count;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: file: %" PRIu32 " alignment padding data:\n",
-				 function,
-				 file_index );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
-		}
-	}
-	for( file_index = 0;
-	     file_index < internal_volume_information->number_of_files;
-	     file_index++ )
-	{
-		if( libagdb_file_information_initialize(
-		     &file_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file: %" PRIu32 " information.",
-			 function,
-			 file_index );
-
-			goto on_error;
-		}
-		read_count = libagdb_internal_file_information_read_file_io_handle(
-		              (libagdb_internal_file_information_t *) file_information,
-		              io_handle,
-		              data_stream,
-		              file_io_handle,
-		              file_offset,
-		              file_index,
-		              error );
-
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file: %" PRIu32 " information.",
-			 function,
-			 file_index );
-
-			goto on_error;
-		}
-		total_read_count += read_count;
-		file_offset      += read_count;
-
-		if( libcdata_array_append_entry(
-		     internal_volume_information->files_array,
-		     &entry_index,
-		     (intptr_t *) file_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append file: %" PRIu32 " information to array.",
-			 function,
-			 file_index );
-
-			goto on_error;
+			total_read_count += (ssize64_t) alignment_padding_size;
+			file_offset      += (off64_t) alignment_padding_size;
 		}
-		file_information = NULL;
 	}
 	return( total_read_count );
 
 on_error:
-	if( file_information != NULL )
-	{
-		libagdb_internal_file_information_free(
-		 (libagdb_internal_file_information_t **) &file_information,
-		 NULL );
-	}
 	if( internal_volume_information->device_path != NULL )
 	{
-		memory_free(
-		 internal_volume_information->device_path );
-
+		if( internal_volume_information->device_path_is_referenced == 0 )
+		{
+			memory_free(
+			 internal_volume_information->device_path );
+		}
 		internal_volume_information->device_path = NULL;
 	}
-	internal_volume_information->device_path_size = 0;
+	internal_volume_information->device_path_size          = 0;
+	internal_volume_information->device_path_is_referenced = 0;
 
-	if( volume_information_data != NULL )
-	{
-		memory_free(
-		 volume_information_data );
-	}
 	return( -1 );
 }
 
-/* Retrieves the 64-bit filetime value containing the volume creation date and time
- * Returns 1 if successful or -1 on error
+/* Reads the volume information
+ * Returns the number of bytes read if successful or -1 on error
  */
-int libagdb_volume_information_get_creation_time(
-     libagdb_volume_information_t *volume_information,
-     uint64_t *creation_time,
-     libcerror_error_t **error )
+ssize64_t libagdb_internal_volume_information_read_file_io_handle(
+           libagdb_internal_volume_information_t *internal_volume_information,
+           libagdb_io_handle_t *io_handle,
+           libfdata_stream_t *data_stream,
+           libbfio_handle_t *file_io_handle,
+           off64_t file_offset,
+           uint32_t volume_index,
+           libcerror_error_t **error )
 {
-	libagdb_internal_volume_information_t *internal_volume_information = NULL;
-	static char *function                                              = "libagdb_volume_information_get_creation_time";
+	static char *function      = "libagdb_internal_volume_information_read_file_io_handle";
+	ssize64_t read_count       = 0;
+	ssize64_t total_read_count = 0;
+	size64_t record_size       = 0;
+	uint32_t file_index        = 0;
 
-	if( volume_information == NULL )
+	if( internal_volume_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1081,54 +1072,253 @@ int libagdb_volume_information_get_creation_time(
 
 		return( -1 );
 	}
-	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
-
-	if( creation_time == NULL )
+	if( internal_volume_information->device_path != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid creation time.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information - device path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	*creation_time = internal_volume_information->creation_time;
-
-	return( 1 );
-}
-
-/* Retrieves the serial number
- * Returns 1 if successful or -1 on error
- */
-int libagdb_volume_information_get_serial_number(
-     libagdb_volume_information_t *volume_information,
-     uint32_t *serial_number,
-     libcerror_error_t **error )
-{
-	libagdb_internal_volume_information_t *internal_volume_information = NULL;
-	static char *function                                              = "libagdb_volume_information_get_serial_number";
-
-	if( volume_information == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume information.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+	read_count = libagdb_internal_volume_information_read_header_file_io_handle(
+	              internal_volume_information,
+	              io_handle,
+	              data_stream,
+	              file_io_handle,
+	              file_offset,
+	              volume_index,
+	              error );
 
-	if( serial_number == NULL )
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume: %" PRIu32 " information header.",
+		 function,
+		 volume_index );
+
+		goto on_error;
+	}
+	total_read_count += read_count;
+	file_offset      += (off64_t) read_count;
+
+	if( internal_volume_information->number_of_files > 0 )
+	{
+		if( ( internal_volume_information->number_of_files > (uint32_t) INT_MAX )
+		 || ( (size_t) internal_volume_information->number_of_files > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volume information - number of files value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_file_table_initialize(
+		     &( internal_volume_information->file_table ),
+		     (int) internal_volume_information->number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_resize(
+		     internal_volume_information->files_array,
+		     (int) internal_volume_information->number_of_files,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_file_information_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize files array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	io_handle->progress.number_of_parsed_files = 0;
+	io_handle->progress.number_of_files        = internal_volume_information->number_of_files;
+
+	/* The file information records are parsed on demand, only the values of their fixed-size part
+	 * are stored in the file table here
+	 */
+	for( file_index = 0;
+	     file_index < internal_volume_information->number_of_files;
+	     file_index++ )
+	{
+		if( libagdb_io_handle_check_abort(
+		     io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read file: %" PRIu32 " information record size.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libagdb_file_information_read_record_size(
+		     io_handle,
+		     internal_volume_information->record_buffer,
+		     data_stream,
+		     file_io_handle,
+		     file_offset,
+		     file_index,
+		     &record_size,
+		     internal_volume_information->file_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file: %" PRIu32 " information record size.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		total_read_count += (ssize64_t) record_size;
+		file_offset      += (off64_t) record_size;
+
+		io_handle->progress.number_of_parsed_files = file_index + 1;
+
+		libagdb_io_handle_report_progress(
+		 io_handle );
+	}
+	internal_volume_information->io_handle      = io_handle;
+	internal_volume_information->data_stream    = data_stream;
+	internal_volume_information->file_io_handle = file_io_handle;
+
+	return( total_read_count );
+
+on_error:
+	if( internal_volume_information->file_table != NULL )
+	{
+		libagdb_file_table_free(
+		 &( internal_volume_information->file_table ),
+		 NULL );
+	}
+	libcdata_array_resize(
+	 internal_volume_information->files_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_file_information_free,
+	 NULL );
+
+	if( internal_volume_information->device_path != NULL )
+	{
+		if( internal_volume_information->device_path_is_referenced == 0 )
+		{
+			memory_free(
+			 internal_volume_information->device_path );
+		}
+		internal_volume_information->device_path = NULL;
+	}
+	internal_volume_information->device_path_size          = 0;
+	internal_volume_information->device_path_is_referenced = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the 64-bit filetime value containing the volume creation date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_creation_time(
+     libagdb_volume_information_t *volume_information,
+     uint64_t *creation_time,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_creation_time";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( creation_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid creation time.",
+		 function );
+
+		return( -1 );
+	}
+	*creation_time = internal_volume_information->creation_time;
+
+	return( 1 );
+}
+
+/* Retrieves the serial number
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_serial_number(
+     libagdb_volume_information_t *volume_information,
+     uint32_t *serial_number,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_serial_number";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid serial number.",
 		 function );
 
@@ -1360,7 +1550,134 @@ int libagdb_volume_information_get_number_of_files(
 	return( 1 );
 }
 
+/* Retrieves the file table
+ * The file table contains the values of the file information records, stored per value
+ * in arrays that are indexed by the file index and that are owned by the volume information
+ * The path offsets are relative to the start of the uncompressed data and the path sizes are
+ * in bytes and include the end of string character
+ * The arrays that are not needed can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_file_table(
+     libagdb_volume_information_t *volume_information,
+     int *number_of_files,
+     const uint32_t **name_hashes,
+     const uint32_t **flags,
+     const uint32_t **number_of_entries,
+     const uint64_t **first_entry_indexes,
+     const off64_t **path_offsets,
+     const uint32_t **path_sizes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_file_table_t *file_table                                   = NULL;
+	static char *function                                              = "libagdb_volume_information_get_file_table";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	file_table = internal_volume_information->file_table;
+
+	if( ( file_table == NULL )
+	 && ( internal_volume_information->number_of_files > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing file table.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_table == NULL )
+	{
+		*number_of_files = 0;
+	}
+	else
+	{
+		*number_of_files = file_table->number_of_set_files;
+	}
+	if( name_hashes != NULL )
+	{
+		*name_hashes = NULL;
+
+		if( file_table != NULL )
+		{
+			*name_hashes = file_table->name_hashes;
+		}
+	}
+	if( flags != NULL )
+	{
+		*flags = NULL;
+
+		if( file_table != NULL )
+		{
+			*flags = file_table->flags;
+		}
+	}
+	if( number_of_entries != NULL )
+	{
+		*number_of_entries = NULL;
+
+		if( file_table != NULL )
+		{
+			*number_of_entries = file_table->number_of_entries;
+		}
+	}
+	if( first_entry_indexes != NULL )
+	{
+		*first_entry_indexes = NULL;
+
+		if( file_table != NULL )
+		{
+			*first_entry_indexes = file_table->first_entry_indexes;
+		}
+	}
+	if( path_offsets != NULL )
+	{
+		*path_offsets = NULL;
+
+		if( file_table != NULL )
+		{
+			*path_offsets = file_table->path_offsets;
+		}
+	}
+	if( path_sizes != NULL )
+	{
+		*path_sizes = NULL;
+
+		if( file_table != NULL )
+		{
+			*path_sizes = file_table->path_sizes;
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves a specific file information
+ * The file information is read on demand and cached in the volume information
  * Returns 1 if successful or -1 on error
  */
 int libagdb_volume_information_get_file_information(
@@ -1369,8 +1686,10 @@ int libagdb_volume_information_get_file_information(
      libagdb_file_information_t **file_information,
      libcerror_error_t **error )
 {
+	libagdb_file_information_t *safe_file_information                  = NULL;
 	libagdb_internal_volume_information_t *internal_volume_information = NULL;
 	static char *function                                              = "libagdb_volume_information_get_file_information";
+	int result                                                         = 0;
 
 	if( volume_information == NULL )
 	{
@@ -1410,7 +1729,7 @@ int libagdb_volume_information_get_file_information(
 	if( libcdata_array_get_entry_by_index(
 	     internal_volume_information->files_array,
 	     file_index,
-	     (intptr_t **) file_information,
+	     (intptr_t **) &safe_file_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1423,6 +1742,1050 @@ int libagdb_volume_information_get_file_information(
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	if( safe_file_information != NULL )
+	{
+		*file_information = safe_file_information;
+
+		return( 1 );
+	}
+	if( internal_volume_information->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_io_handle_start_activity(
+	     internal_volume_information->io_handle,
+	     internal_volume_information->io_handle->time_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start activity.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_internal_volume_information_get_file_information(
+	          internal_volume_information,
+	          file_index,
+	          file_information,
+	          error );
 
+	internal_volume_information->io_handle->deadline = 0;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %d information.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific file information
+ * The file information is read on demand, as part of the current activity, and cached in the volume information
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_volume_information_get_file_information(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *safe_file_information = NULL;
+	uint8_t *sub_entries_buffer                       = NULL;
+	static char *function                             = "libagdb_internal_volume_information_get_file_information";
+	size_t sub_entries_buffer_size                    = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_information->files_array,
+	     file_index,
+	     (intptr_t **) &safe_file_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d information.",
+		 function,
+		 file_index );
+
+		goto on_error;
+	}
+	if( safe_file_information == NULL )
+	{
+		if( internal_volume_information->file_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid volume information - missing file table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_io_handle_check_abort(
+		     internal_volume_information->io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		/* The paths are stored in a single pool instead of an allocation per file information,
+		 * unless the paths can reference the mapped data
+		 */
+		if( ( internal_volume_information->path_pool == NULL )
+		 && ( internal_volume_information->io_handle != NULL )
+		 && ( internal_volume_information->io_handle->mapped_data == NULL ) )
+		{
+			if( libagdb_path_pool_initialize(
+			     &( internal_volume_information->path_pool ),
+			     LIBAGDB_PATH_POOL_BLOCK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create path pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_internal_volume_information_get_sub_entries_buffer(
+		     internal_volume_information,
+		     file_index,
+		     &sub_entries_buffer,
+		     &sub_entries_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d sub entries buffer.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libagdb_file_information_initialize(
+		     &safe_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libagdb_internal_file_information_read_file_io_handle(
+		     (libagdb_internal_file_information_t *) safe_file_information,
+		     internal_volume_information->io_handle,
+		     internal_volume_information->record_buffer,
+		     internal_volume_information->path_pool,
+		     sub_entries_buffer,
+		     sub_entries_buffer_size,
+		     internal_volume_information->data_stream,
+		     internal_volume_information->file_io_handle,
+		     internal_volume_information->file_table->record_offsets[ file_index ],
+		     (uint32_t) file_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_volume_information->files_array,
+		     file_index,
+		     (intptr_t *) safe_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file: %d information in array.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	*file_information = safe_file_information;
+
+	return( 1 );
+
+on_error:
+	if( safe_file_information != NULL )
+	{
+		libagdb_internal_file_information_free(
+		 (libagdb_internal_file_information_t **) &safe_file_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the part of the sub entries buffer of a specific file
+ * The sub entries of all the files are stored in a single buffer, at the index of their first entry,
+ * which is allocated on demand. The buffer is not used if the sub entries can reference the mapped data
+ * The sub entries buffer is set to NULL if it is not used or if the file has no sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_volume_information_get_sub_entries_buffer(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     uint8_t **sub_entries_buffer,
+     size_t *sub_entries_buffer_size,
+     libcerror_error_t **error )
+{
+	libagdb_file_table_t *file_table = NULL;
+	static char *function            = "libagdb_internal_volume_information_get_sub_entries_buffer";
+	uint64_t number_of_sub_entries   = 0;
+	uint32_t sub_entry_size          = 0;
+	int last_file_index              = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing file table.",
+		 function );
+
+		return( -1 );
+	}
+	file_table = internal_volume_information->file_table;
+
+	if( ( file_index < 0 )
+	 || ( file_index >= file_table->number_of_set_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_entries_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub entries buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_entries_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub entries buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_entries_buffer      = NULL;
+	*sub_entries_buffer_size = 0;
+
+	if( ( internal_volume_information->io_handle == NULL )
+	 || ( internal_volume_information->io_handle->mapped_data != NULL )
+	 || ( file_table->number_of_entries[ file_index ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The sub entry size is validated when the file table is filled
+	 */
+	sub_entry_size = internal_volume_information->io_handle->file_information_sub_entry_type1_size;
+
+	if( internal_volume_information->sub_entries_data == NULL )
+	{
+		last_file_index = file_table->number_of_set_files - 1;
+
+		number_of_sub_entries = file_table->first_entry_indexes[ last_file_index ]
+		                      + file_table->number_of_entries[ last_file_index ];
+
+		/* Fall back to an allocation per file information if the buffer would be too large
+		 */
+		if( number_of_sub_entries > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sub_entry_size ) )
+		{
+			return( 1 );
+		}
+		internal_volume_information->sub_entries_data_size = (size_t) number_of_sub_entries * sub_entry_size;
+
+		internal_volume_information->sub_entries_data = (uint8_t *) memory_allocate(
+		                                                             sizeof( uint8_t ) * internal_volume_information->sub_entries_data_size );
+
+		if( internal_volume_information->sub_entries_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub entries data.",
+			 function );
+
+			internal_volume_information->sub_entries_data_size = 0;
+
+			return( -1 );
+		}
+	}
+	*sub_entries_buffer      = &( internal_volume_information->sub_entries_data[ file_table->first_entry_indexes[ file_index ] * sub_entry_size ] );
+	*sub_entries_buffer_size = (size_t) file_table->number_of_entries[ file_index ] * sub_entry_size;
+
+	return( 1 );
+}
+
+/* Builds the file hash table
+ * The table is built from the name hashes stored in the file table, the file information
+ * records are not read. Since a stored name hash is not known to match the hash of the path
+ * for every record, lookups that find no match in the table fall back to comparing paths
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_volume_information_build_file_hash_table(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libcerror_error_t **error )
+{
+	static char *function         = "libagdb_internal_volume_information_build_file_hash_table";
+	uint32_t file_hash_table_size = 0;
+	uint32_t file_index           = 0;
+	uint32_t slot_index           = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->file_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information - file hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->number_of_files == 0 )
+	{
+		internal_volume_information->file_hash_table_is_built = 1;
+
+		return( 1 );
+	}
+	if( internal_volume_information->file_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing file table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a load factor of at most 0.5 to keep the probe sequences short
+	 */
+	file_hash_table_size = 1;
+
+	while( file_hash_table_size < ( internal_volume_information->number_of_files * 2 ) )
+	{
+		file_hash_table_size <<= 1;
+	}
+	if( (size_t) file_hash_table_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information->file_hash_table = (int *) memory_allocate(
+	                                                        sizeof( int ) * file_hash_table_size );
+
+	if( internal_volume_information->file_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_volume_information->file_hash_table,
+	     0,
+	     sizeof( int ) * file_hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file hash table.",
+		 function );
+
+		memory_free(
+		 internal_volume_information->file_hash_table );
+
+		internal_volume_information->file_hash_table = NULL;
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_volume_information->number_of_files;
+	     file_index++ )
+	{
+		slot_index = internal_volume_information->file_table->name_hashes[ file_index ] & ( file_hash_table_size - 1 );
+
+		while( internal_volume_information->file_hash_table[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( file_hash_table_size - 1 );
+		}
+		internal_volume_information->file_hash_table[ slot_index ] = (int) file_index + 1;
+	}
+	internal_volume_information->file_hash_table_size     = file_hash_table_size;
+	internal_volume_information->file_hash_table_is_built = 1;
+
+	return( 1 );
+}
+
+/* Determines if the path of a specific file information matches an UTF-16 little-endian stream
+ * The stream should not contain the end of string character
+ * Returns 1 if the path matches, 0 if not or -1 on error
+ */
+int libagdb_internal_volume_information_match_file_path(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *safe_file_information              = NULL;
+	libagdb_internal_file_information_t *internal_file_information = NULL;
+	static char *function                                          = "libagdb_internal_volume_information_match_file_path";
+
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_volume_information_get_file_information(
+	     internal_volume_information,
+	     file_index,
+	     &safe_file_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d information.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) safe_file_information;
+
+	if( ( internal_file_information->path == NULL )
+	 || ( (size_t) internal_file_information->path_size != ( utf16_stream_size + 2 ) ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     internal_file_information->path,
+	     utf16_stream,
+	     utf16_stream_size ) != 0 )
+	{
+		return( 0 );
+	}
+	*file_information = safe_file_information;
+
+	return( 1 );
+}
+
+/* Retrieves the file information for an UTF-16 little-endian stream encoded path
+ * The stream should not contain the end of string character
+ * The lookup is a separate activity, that is limited by the time budget
+ * Returns 1 if successful, 0 if no such file information or -1 on error
+ */
+int libagdb_internal_volume_information_get_file_information_by_utf16_stream(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_volume_information_get_file_information_by_utf16_stream";
+	uint32_t file_index   = 0;
+	uint32_t hash_value   = 0;
+	uint32_t slot_index   = 0;
+	int result            = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_io_handle_start_activity(
+	     internal_volume_information->io_handle,
+	     internal_volume_information->io_handle->time_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start activity.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->file_hash_table_is_built == 0 )
+	{
+		if( libagdb_internal_volume_information_build_file_hash_table(
+		     internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build file hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file hash table is not created if the volume has no files
+	 */
+	if( internal_volume_information->file_hash_table != NULL )
+	{
+		if( libagdb_hash_calculate(
+		     &hash_value,
+		     utf16_stream,
+		     utf16_stream_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path hash value.",
+			 function );
+
+			goto on_error;
+		}
+		slot_index = hash_value & ( internal_volume_information->file_hash_table_size - 1 );
+
+		while( internal_volume_information->file_hash_table[ slot_index ] != 0 )
+		{
+			file_index = (uint32_t) internal_volume_information->file_hash_table[ slot_index ] - 1;
+
+			if( internal_volume_information->file_table->name_hashes[ file_index ] == hash_value )
+			{
+				result = libagdb_internal_volume_information_match_file_path(
+				          internal_volume_information,
+				          (int) file_index,
+				          utf16_stream,
+				          utf16_stream_size,
+				          file_information,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+			slot_index = ( slot_index + 1 ) & ( internal_volume_information->file_hash_table_size - 1 );
+		}
+		/* The stored name hash of the file information record can differ from the hash
+		 * of its path, hence the paths of the records with the same path size and
+		 * a different stored name hash are compared
+		 */
+		if( result == 0 )
+		{
+			for( file_index = 0;
+			     file_index < internal_volume_information->number_of_files;
+			     file_index++ )
+			{
+				if( ( internal_volume_information->file_table->name_hashes[ file_index ] == hash_value )
+				 || ( (size_t) internal_volume_information->file_table->path_sizes[ file_index ] != ( utf16_stream_size + 2 ) ) )
+				{
+					continue;
+				}
+				if( libagdb_io_handle_check_abort(
+				     internal_volume_information->io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+					 "%s: unable to match file: %" PRIu32 " path.",
+					 function,
+					 file_index );
+
+					goto on_error;
+				}
+				result = libagdb_internal_volume_information_match_file_path(
+				          internal_volume_information,
+				          (int) file_index,
+				          utf16_stream,
+				          utf16_stream_size,
+				          file_information,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match file: %" PRIu32 " path.",
+		 function,
+		 file_index );
+
+		goto on_error;
+	}
+	internal_volume_information->io_handle->deadline = 0;
+
+	return( result );
+
+on_error:
+	internal_volume_information->io_handle->deadline = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the file information for an UTF-8 encoded path
+ * The path must match the path stored in the file information record, which
+ * is relative from the root of the volume, for example "\WINDOWS\SYSTEM32\NTDLL.DLL"
+ * Returns 1 if successful, 0 if no such file information or -1 on error
+ */
+int libagdb_volume_information_get_file_information_by_utf8_path(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error )
+{
+	uint16_t utf16_characters[ 2 ];
+
+	libuna_unicode_character_t unicode_character = 0;
+	uint8_t *utf16_stream                        = NULL;
+	static char *function                        = "libagdb_volume_information_get_file_information_by_utf8_path";
+	size_t utf16_character_index                 = 0;
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	int result                                   = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* An UTF-8 encoded character never requires more UTF-16 code units than bytes
+	 */
+	utf16_stream = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * utf8_string_length * 2 );
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			goto on_error;
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		utf16_character_index = 0;
+
+		if( libuna_unicode_character_copy_to_utf16(
+		     unicode_character,
+		     utf16_characters,
+		     2,
+		     &utf16_character_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to UTF-16.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 utf16_characters[ 0 ] );
+
+		utf16_stream_index += 2;
+
+		if( utf16_character_index == 2 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 utf16_characters[ 1 ] );
+
+			utf16_stream_index += 2;
+		}
+	}
+	result = libagdb_internal_volume_information_get_file_information_by_utf16_stream(
+	          (libagdb_internal_volume_information_t *) volume_information,
+	          utf16_stream,
+	          utf16_stream_index,
+	          file_information,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file information by UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_stream );
+
+	return( result );
+
+on_error:
+	if( utf16_stream != NULL )
+	{
+		memory_free(
+		 utf16_stream );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file information for an UTF-16 encoded path
+ * The path must match the path stored in the file information record, which
+ * is relative from the root of the volume, for example "\WINDOWS\SYSTEM32\NTDLL.DLL"
+ * Returns 1 if successful, 0 if no such file information or -1 on error
+ */
+int libagdb_volume_information_get_file_information_by_utf16_path(
+     libagdb_volume_information_t *volume_information,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error )
+{
+	uint8_t *utf16_stream     = NULL;
+	static char *function     = "libagdb_volume_information_get_file_information_by_utf16_path";
+	size_t utf16_stream_index = 0;
+	size_t utf16_string_index = 0;
+	int result                = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	utf16_stream = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * utf16_string_length * 2 );
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( utf16_string[ utf16_string_index ] == 0 )
+		{
+			break;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 utf16_string[ utf16_string_index ] );
+
+		utf16_string_index += 1;
+		utf16_stream_index += 2;
+	}
+	result = libagdb_internal_volume_information_get_file_information_by_utf16_stream(
+	          (libagdb_internal_volume_information_t *) volume_information,
+	          utf16_stream,
+	          utf16_stream_index,
+	          file_information,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file information by UTF-16 stream.",
+		 function );
+	}
+	memory_free(
+	 utf16_stream );
+
+	return( result );
+}
@@ -26,12 +26,15 @@
 #include <types.h>
 
 #include "libagdb_extern.h"
+#include "libagdb_file_table.h"
 #include "libagdb_io_handle.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcdata.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_path_pool.h"
+#include "libagdb_record_buffer.h"
 #include "libagdb_types.h"
 
 #if defined( __cplusplus )
@@ -50,6 +53,10 @@ struct libagdb_internal_volume_information
 	 */
 	uint32_t device_path_size;
 
+	/* Value to indicate the device path references data that is not owned by the volume information
+	 */
+	uint8_t device_path_is_referenced;
+
 	/* The volume creation time
 	 */
 	uint64_t creation_time;
@@ -65,6 +72,55 @@ struct libagdb_internal_volume_information
 	/* The files array
 	 */
 	libcdata_array_t *files_array;
+
+	/* The file table, that contains the values of the fixed-size part of the file information records
+	 */
+	libagdb_file_table_t *file_table;
+
+	/* The file hash table, which maps a stored name hash onto the file index + 1 of the file
+	 * information record using open addressing, where 0 represents an empty slot
+	 * NULL if the table was not built or the volume has no files
+	 */
+	int *file_hash_table;
+
+	/* The number of slots in the file hash table, which is a power of 2
+	 */
+	uint32_t file_hash_table_size;
+
+	/* Value to indicate the file hash table was built
+	 */
+	uint8_t file_hash_table_is_built;
+
+	/* The record buffer
+	 */
+	libagdb_record_buffer_t *record_buffer;
+
+	/* The path pool, that contains the paths of the file information records
+	 * NULL if the paths are not pooled
+	 */
+	libagdb_path_pool_t *path_pool;
+
+	/* The sub entries data, that contains the sub entries of the file information records
+	 * at the index of their first entry
+	 * NULL if the sub entries are not buffered
+	 */
+	uint8_t *sub_entries_data;
+
+	/* The sub entries data size
+	 */
+	size_t sub_entries_data_size;
+
+	/* The IO handle
+	 */
+	libagdb_io_handle_t *io_handle;
+
+	/* The data stream
+	 */
+	libfdata_stream_t *data_stream;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
 };
 
 int libagdb_volume_information_initialize(
@@ -93,6 +149,15 @@ int libagdb_internal_volume_information_read_device_path_data(
      size_t data_size,
      libcerror_error_t **error );
 
+ssize64_t libagdb_internal_volume_information_read_header_file_io_handle(
+           libagdb_internal_volume_information_t *internal_volume_information,
+           libagdb_io_handle_t *io_handle,
+           libfdata_stream_t *data_stream,
+           libbfio_handle_t *file_io_handle,
+           off64_t file_offset,
+           uint32_t volume_index,
+           libcerror_error_t **error );
+
 ssize64_t libagdb_internal_volume_information_read_file_io_handle(
            libagdb_internal_volume_information_t *internal_volume_information,
            libagdb_io_handle_t *io_handle,
@@ -102,6 +167,38 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
            uint32_t volume_index,
            libcerror_error_t **error );
 
+int libagdb_internal_volume_information_get_file_information(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_get_sub_entries_buffer(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     uint8_t **sub_entries_buffer,
+     size_t *sub_entries_buffer_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_build_file_hash_table(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_match_file_path(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     int file_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_get_file_information_by_utf16_stream(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_volume_information_get_creation_time(
      libagdb_volume_information_t *volume_information,
@@ -146,6 +243,18 @@ int libagdb_volume_information_get_number_of_files(
      int *number_of_files,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_table(
+     libagdb_volume_information_t *volume_information,
+     int *number_of_files,
+     const uint32_t **name_hashes,
+     const uint32_t **flags,
+     const uint32_t **number_of_entries,
+     const uint64_t **first_entry_indexes,
+     const off64_t **path_offsets,
+     const uint32_t **path_sizes,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_volume_information_get_file_information(
      libagdb_volume_information_t *volume_information,
@@ -153,6 +262,22 @@ int libagdb_volume_information_get_file_information(
      libagdb_file_information_t **file_information,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_information_by_utf8_path(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_information_by_utf16_path(
+     libagdb_volume_information_t *volume_information,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libagdb_file_information_t **file_information,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1254 @@
+/*
+ * Library throughput benchmark program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "agdb_test_getopt.h"
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_libfdata.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+#include "../libagdb/libagdb_compressed_block.h"
+#include "../libagdb/libagdb_file.h"
+#include "../libagdb/libagdb_io_handle.h"
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The size of the buffer used to read the uncompressed data stream
+ */
+#define AGDB_BENCH_READ_BUFFER_SIZE	65536
+
+/* Counts the records reported by libagdb_file_scan
+ */
+typedef struct agdb_bench_scan_counts agdb_bench_scan_counts_t;
+
+struct agdb_bench_scan_counts
+{
+	/* The number of volumes
+	 */
+	int number_of_volumes;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+};
+
+/* Prints usage information
+ */
+void agdb_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use agdb_bench to measure the throughput of libagdb on\n"
+	                 "one or more Windows SuperFetch database files.\n\n" );
+
+	fprintf( stream, "Usage: agdb_bench [ -i iterations ] [ -hV ] source ...\n\n" );
+
+	fprintf( stream, "\tsource: a Windows SuperFetch database file, uncompressed\n"
+	                 "\t        or MEMO, MEM0 or MAM compressed\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations per phase (default is 10)\n" );
+	fprintf( stream, "\t-V:     print version\n\n" );
+
+	fprintf( stream, "The results are written to stdout as tab separated values with the columns:\n"
+	                 "source, format, phase, bytes, iterations, seconds and MB/s (10^6 bytes per second).\n"
+	                 "The phases are:\n"
+	                 "\topen:       libagdb_file_open and libagdb_file_close of the file\n"
+	                 "\tindex:      building the compressed block index (MEMO and MEM0 only)\n"
+	                 "\tdecompress: decompressing all the uncompressed data (compressed files only)\n"
+	                 "\tparse:      parsing all volume, file and source records with libagdb_file_scan\n"
+	                 "\t            the compressed blocks of MEMO and MEM0 files are decompressed before\n"
+	                 "\t            the phase starts, MAM files are decoded as part of the phase\n\n" );
+}
+
+/* Retrieves a monotonic time stamp in seconds
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_get_time(
+     double *time_stamp )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#endif
+
+	if( time_stamp == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( -1 );
+	}
+	*time_stamp = (double) counter.QuadPart / (double) frequency.QuadPart;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( -1 );
+	}
+	*time_stamp = (double) time_value.tv_sec + ( (double) time_value.tv_nsec / 1000000000.0 );
+#else
+	*time_stamp = (double) time(
+	                        NULL );
+#endif
+	return( 1 );
+}
+
+/* Prints the result of a benchmark phase
+ */
+void agdb_bench_result_fprint(
+      FILE *stream,
+      const system_character_t *source,
+      const char *format,
+      const char *phase,
+      size64_t number_of_bytes,
+      int number_of_iterations,
+      double seconds )
+{
+	double megabytes_per_second = 0.0;
+
+	if( stream == NULL )
+	{
+		return;
+	}
+	if( seconds > 0.0 )
+	{
+		megabytes_per_second = ( (double) number_of_bytes * (double) number_of_iterations ) / ( seconds * 1000000.0 );
+	}
+	fprintf(
+	 stream,
+	 "%" PRIs_SYSTEM "\t%s\t%s\t%" PRIu64 "\t%d\t%.6f\t%.3f\n",
+	 source,
+	 format,
+	 phase,
+	 number_of_bytes,
+	 number_of_iterations,
+	 seconds,
+	 megabytes_per_second );
+}
+
+/* Creates and opens a file
+ * A number of decompression threads of 0 represents the compressed blocks are decompressed on demand
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_file_open(
+     libagdb_file_t **file,
+     const system_character_t *source,
+     int number_of_decompression_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "agdb_bench_file_open";
+	int result            = 0;
+
+	if( libagdb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_decompression_threads > 0 )
+	{
+		if( libagdb_file_set_number_of_decompression_threads(
+		     *file,
+		     number_of_decompression_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of decompression threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          *file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          error );
+#else
+	result = libagdb_file_open(
+	          *file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libagdb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_file_close(
+     libagdb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "agdb_bench_file_close";
+	int result            = 1;
+
+	if( libagdb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libagdb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Counts a volume reported by libagdb_file_scan
+ * Returns 1 to continue the scan
+ */
+int agdb_bench_scan_volume_callback(
+     libagdb_volume_information_t *volume_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int volume_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_index )
+
+	( (agdb_bench_scan_counts_t *) user_data )->number_of_volumes += 1;
+
+	return( 1 );
+}
+
+/* Counts a file reported by libagdb_file_scan
+ * Returns 1 to continue the scan
+ */
+int agdb_bench_scan_file_callback(
+     libagdb_volume_information_t *volume_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int volume_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     libagdb_file_information_t *file_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int file_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_index )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_index )
+
+	( (agdb_bench_scan_counts_t *) user_data )->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Counts a source reported by libagdb_file_scan
+ * Returns 1 to continue the scan
+ */
+int agdb_bench_scan_source_callback(
+     libagdb_source_information_t *source_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int source_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( source_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( source_index )
+
+	( (agdb_bench_scan_counts_t *) user_data )->number_of_sources += 1;
+
+	return( 1 );
+}
+
+/* Measures opening and closing a file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_phase_open(
+     const system_character_t *source,
+     int number_of_iterations,
+     double *seconds,
+     libcerror_error_t **error )
+{
+	libagdb_file_t *file  = NULL;
+	static char *function = "agdb_bench_phase_open";
+	double end_time       = 0.0;
+	double start_time     = 0.0;
+	int iteration         = 0;
+
+	*seconds = 0.0;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( agdb_bench_get_time(
+		     &start_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		if( agdb_bench_file_open(
+		     &file,
+		     source,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( agdb_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &end_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		*seconds += end_time - start_time;
+	}
+	return( 1 );
+
+on_time_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve time.",
+	 function );
+
+on_error:
+	if( file != NULL )
+	{
+		agdb_bench_file_close(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures parsing all the records of a file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_phase_parse(
+     const system_character_t *source,
+     int number_of_iterations,
+     double *seconds,
+     libcerror_error_t **error )
+{
+	agdb_bench_scan_counts_t counts;
+
+	libagdb_file_t *file  = NULL;
+	static char *function = "agdb_bench_phase_parse";
+	double end_time       = 0.0;
+	double start_time     = 0.0;
+	int iteration         = 0;
+
+	*seconds = 0.0;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		/* Decompress all the compressed blocks on open so the phase measures the record parsing
+		 */
+		if( agdb_bench_file_open(
+		     &file,
+		     source,
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( memory_set(
+		     &counts,
+		     0,
+		     sizeof( agdb_bench_scan_counts_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear counts.",
+			 function );
+
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &start_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		if( libagdb_file_scan(
+		     file,
+		     &agdb_bench_scan_volume_callback,
+		     &agdb_bench_scan_file_callback,
+		     &agdb_bench_scan_source_callback,
+		     (void *) &counts,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan file.",
+			 function );
+
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &end_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		*seconds += end_time - start_time;
+
+		if( agdb_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_time_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve time.",
+	 function );
+
+on_error:
+	if( file != NULL )
+	{
+		agdb_bench_file_close(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Measures building the compressed blocks index of a MEMO or MEM0 compressed file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_phase_index(
+     libagdb_internal_file_t *internal_file,
+     int number_of_iterations,
+     double *seconds,
+     libcerror_error_t **error )
+{
+	libfdata_list_t *compressed_blocks_list = NULL;
+	static char *function                   = "agdb_bench_phase_index";
+	double end_time                         = 0.0;
+	double start_time                       = 0.0;
+	int iteration                           = 0;
+
+	*seconds = 0.0;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libfdata_list_initialize(
+		     &compressed_blocks_list,
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &start_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		if( libagdb_io_handle_read_compressed_blocks(
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     compressed_blocks_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &end_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		*seconds += end_time - start_time;
+
+		if( libfdata_list_free(
+		     &compressed_blocks_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_time_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve time.",
+	 function );
+
+on_error:
+	if( compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &compressed_blocks_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses all the compressed blocks of a MEMO or MEM0 compressed file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_decompress_blocks(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libagdb_compressed_block_t *compressed_block = NULL;
+	libfdata_list_element_t *list_element        = NULL;
+	static char *function                        = "agdb_bench_decompress_blocks";
+	size64_t compressed_block_size               = 0;
+	size64_t uncompressed_block_size             = 0;
+	off64_t compressed_block_offset              = 0;
+	uint32_t compressed_block_flags              = 0;
+	int compressed_block_file_index              = 0;
+	int block_index                              = 0;
+	int number_of_blocks                         = 0;
+
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->compressed_blocks_list,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of compressed blocks.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     internal_file->compressed_blocks_list,
+		     block_index,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( libfdata_list_element_get_data_range(
+		     list_element,
+		     &compressed_block_file_index,
+		     &compressed_block_offset,
+		     &compressed_block_size,
+		     &compressed_block_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d data range.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( libfdata_list_element_get_mapped_size(
+		     list_element,
+		     &uncompressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed blocks list element: %d mapped size.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( libagdb_compressed_block_initialize(
+		     &compressed_block,
+		     (size_t) uncompressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_compressed_block_read(
+		     compressed_block,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     compressed_block_offset,
+		     (size_t) compressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed block: %d.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( libagdb_compressed_block_free(
+		     &compressed_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_block != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads all the data of the uncompressed data stream of a MAM compressed file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_decompress_stream(
+     libagdb_internal_file_t *internal_file,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "agdb_bench_decompress_stream";
+	size64_t stream_size  = 0;
+	off64_t stream_offset = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( libfdata_stream_get_size(
+	     internal_file->uncompressed_data_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream size.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) stream_offset < stream_size )
+	{
+		read_size = AGDB_BENCH_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_size > ( stream_size - (size64_t) stream_offset ) )
+		{
+			read_size = (size_t) ( stream_size - (size64_t) stream_offset );
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_file->uncompressed_data_stream,
+		              (intptr_t *) internal_file->file_io_handle,
+		              buffer,
+		              read_size,
+		              stream_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 stream_offset,
+			 stream_offset );
+
+			return( -1 );
+		}
+		stream_offset += read_count;
+	}
+	return( 1 );
+}
+
+/* Measures decompressing all the uncompressed data of a compressed file
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_phase_decompress(
+     const system_character_t *source,
+     int number_of_iterations,
+     double *seconds,
+     libcerror_error_t **error )
+{
+	libagdb_file_t *file  = NULL;
+	uint8_t *buffer       = NULL;
+	static char *function = "agdb_bench_phase_decompress";
+	double end_time       = 0.0;
+	double start_time     = 0.0;
+	int iteration         = 0;
+	int result            = 0;
+
+	*seconds = 0.0;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * AGDB_BENCH_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		/* A newly opened file is used to start every iteration with empty caches
+		 */
+		if( agdb_bench_file_open(
+		     &file,
+		     source,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &start_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		if( ( (libagdb_internal_file_t *) file )->compressed_blocks_list != NULL )
+		{
+			result = agdb_bench_decompress_blocks(
+			          (libagdb_internal_file_t *) file,
+			          error );
+		}
+		else
+		{
+			result = agdb_bench_decompress_stream(
+			          (libagdb_internal_file_t *) file,
+			          buffer,
+			          error );
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		if( agdb_bench_get_time(
+		     &end_time ) != 1 )
+		{
+			goto on_time_error;
+		}
+		*seconds += end_time - start_time;
+
+		if( agdb_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_time_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve time.",
+	 function );
+
+on_error:
+	if( file != NULL )
+	{
+		agdb_bench_file_close(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Retrieves a description of the format of a file
+ * Returns the description
+ */
+const char *agdb_bench_get_format(
+             uint8_t file_type )
+{
+	switch( file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+			return( "uncompressed" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			return( "MEMO" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			return( "MEM0" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8:
+			return( "MAM" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* Runs all the benchmark phases for a source
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_bench_source(
+     const system_character_t *source,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	libagdb_file_t *file  = NULL;
+	const char *format    = "unknown";
+	static char *function = "agdb_bench_source";
+	size64_t data_size    = 0;
+	size64_t file_size    = 0;
+	double seconds        = 0.0;
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+	libagdb_internal_file_t *internal_file = NULL;
+	uint8_t file_type                      = 0;
+#endif
+
+	if( agdb_bench_file_open(
+	     &file,
+	     source,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+	internal_file = (libagdb_internal_file_t *) file;
+	file_type     = internal_file->io_handle->file_type;
+	format        = agdb_bench_get_format(
+	                 file_type );
+	file_size     = internal_file->io_handle->file_size;
+	data_size     = (size64_t) internal_file->io_handle->uncompressed_data_size;
+
+	if( ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	 || ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 ) )
+	{
+		if( agdb_bench_phase_index(
+		     internal_file,
+		     number_of_iterations,
+		     &seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to run index phase.",
+			 function );
+
+			goto on_error;
+		}
+		agdb_bench_result_fprint(
+		 stdout,
+		 source,
+		 format,
+		 "index",
+		 file_size,
+		 number_of_iterations,
+		 seconds );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	if( agdb_bench_file_close(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( agdb_bench_phase_open(
+	     source,
+	     number_of_iterations,
+	     &seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to run open phase.",
+		 function );
+
+		goto on_error;
+	}
+	agdb_bench_result_fprint(
+	 stdout,
+	 source,
+	 format,
+	 "open",
+	 file_size,
+	 number_of_iterations,
+	 seconds );
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+	if( file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( agdb_bench_phase_decompress(
+		     source,
+		     number_of_iterations,
+		     &seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to run decompress phase.",
+			 function );
+
+			goto on_error;
+		}
+		agdb_bench_result_fprint(
+		 stdout,
+		 source,
+		 format,
+		 "decompress",
+		 data_size,
+		 number_of_iterations,
+		 seconds );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	if( agdb_bench_phase_parse(
+	     source,
+	     number_of_iterations,
+	     &seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to run parse phase.",
+		 function );
+
+		goto on_error;
+	}
+	agdb_bench_result_fprint(
+	 stdout,
+	 source,
+	 format,
+	 "parse",
+	 data_size,
+	 number_of_iterations,
+	 seconds );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		agdb_bench_file_close(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_iterations = NULL;
+	system_integer_t option               = 0;
+	int number_of_iterations              = 10;
+
+	while( ( option = agdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				agdb_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				agdb_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "agdb_bench %s\n",
+				 LIBAGDB_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file(s).\n" );
+
+		agdb_bench_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_iterations != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_iterations = (int) wcstol(
+		                              option_iterations,
+		                              NULL,
+		                              10 );
+#else
+		number_of_iterations = (int) strtol(
+		                              option_iterations,
+		                              NULL,
+		                              10 );
+#endif
+		if( number_of_iterations <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations: %" PRIs_SYSTEM ".\n",
+			 option_iterations );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "source\tformat\tphase\tbytes\titerations\tseconds\tMB/s\n" );
+
+	while( optind < argc )
+	{
+		if( agdb_bench_source(
+		     argv[ optind ],
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -309,6 +310,79 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_compressed_block_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_decompress(
+     void )
+{
+	uint8_t compressed_data[ 16 ];
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 64;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 compressed_data,
+	 0,
+	 16 );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_decompress(
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8,
+	          compressed_data,
+	          16,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_decompress(
+	          LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	          compressed_data,
+	          16,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
 /* The main program
@@ -336,6 +410,10 @@ int main(
 	 "libagdb_compressed_block_free",
 	 agdb_test_compressed_block_free );
 
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_decompress",
+	 agdb_test_compressed_block_decompress );
+
 	/* TODO: add tests for libagdb_compressed_block_read */
 
 	/* TODO: add tests for libagdb_compressed_block_read_element_data */
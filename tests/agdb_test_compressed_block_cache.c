@@ -0,0 +1,1382 @@
+/*
+ * Library compressed_block_cache type test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_functions.h"
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libbfio.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_libfdata.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_compressed_block.h"
+#include "../libagdb/libagdb_compressed_block_cache.h"
+#include "../libagdb/libagdb_compressed_block_pool.h"
+#include "../libagdb/libagdb_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_compressed_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_cache_initialize(
+     void )
+{
+	libagdb_compressed_block_cache_t *compressed_block_cache = NULL;
+	libcerror_error_t *error                                 = NULL;
+	int result                                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          4,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_free(
+	          &compressed_block_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_cache_initialize(
+	          NULL,
+	          4,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          0,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          4,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block_cache != NULL )
+	{
+		libagdb_compressed_block_cache_free(
+		 &compressed_block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_cache_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_cache_get_block and libagdb_compressed_block_cache_set_block functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_cache_set_block(
+     void )
+{
+	libagdb_compressed_block_cache_t *compressed_block_cache = NULL;
+	libagdb_compressed_block_t *cached_block                 = NULL;
+	libagdb_compressed_block_t *compressed_block             = NULL;
+	libcerror_error_t *error                                 = NULL;
+	int block_index                                          = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          4,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( block_index = 0;
+	     block_index < 2;
+	     block_index++ )
+	{
+		result = libagdb_compressed_block_initialize(
+		          &compressed_block,
+		          16,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_compressed_block_cache_set_block(
+		          compressed_block_cache,
+		          block_index,
+		          compressed_block,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_block = NULL;
+	}
+	/* Access block 0 so that block 1 becomes the least recently used
+	 */
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          0,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_block",
+	 cached_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_initialize(
+	          &compressed_block,
+	          16,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_set_block(
+	          compressed_block_cache,
+	          2,
+	          compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_block = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_cache->number_of_entries",
+	 compressed_block_cache->number_of_entries,
+	 2 );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          1,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          0,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          2,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_cache_get_block(
+	          NULL,
+	          0,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          4,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_set_block(
+	          NULL,
+	          3,
+	          cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_set_block(
+	          compressed_block_cache,
+	          3,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set block with a block that is already cached
+	 */
+	result = libagdb_compressed_block_cache_set_block(
+	          compressed_block_cache,
+	          0,
+	          cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_compressed_block_cache_free(
+	          &compressed_block_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	if( compressed_block_cache != NULL )
+	{
+		libagdb_compressed_block_cache_free(
+		 &compressed_block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_cache_remove_block function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_cache_remove_block(
+     void )
+{
+	libagdb_compressed_block_cache_t *compressed_block_cache = NULL;
+	libagdb_compressed_block_t *cached_block                 = NULL;
+	libagdb_compressed_block_t *compressed_block             = NULL;
+	libcerror_error_t *error                                 = NULL;
+	int block_index                                          = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          4,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( block_index = 0;
+	     block_index < 2;
+	     block_index++ )
+	{
+		result = libagdb_compressed_block_initialize(
+		          &compressed_block,
+		          16,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_compressed_block_cache_set_block(
+		          compressed_block_cache,
+		          block_index,
+		          compressed_block,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_block = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_cache_remove_block(
+	          compressed_block_cache,
+	          0,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block",
+	 compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_cache->number_of_entries",
+	 compressed_block_cache->number_of_entries,
+	 1 );
+
+	result = libagdb_compressed_block_free(
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          0,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block that was moved into the entry of the removed block remains cached
+	 */
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          1,
+	          &cached_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_block",
+	 cached_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_remove_block(
+	          compressed_block_cache,
+	          0,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block",
+	 compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_cache_remove_block(
+	          NULL,
+	          1,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_remove_block(
+	          compressed_block_cache,
+	          4,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_remove_block(
+	          compressed_block_cache,
+	          1,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_compressed_block_cache_free(
+	          &compressed_block_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	if( compressed_block_cache != NULL )
+	{
+		libagdb_compressed_block_cache_free(
+		 &compressed_block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_cache_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_cache_read_block(
+     void )
+{
+	libagdb_compressed_block_t *compressed_block             = NULL;
+	libagdb_compressed_block_t *evicted_compressed_block     = NULL;
+	libagdb_compressed_block_t *first_compressed_block       = NULL;
+	libagdb_compressed_block_cache_t *compressed_block_cache = NULL;
+	libagdb_compressed_block_pool_t *compressed_block_pool   = NULL;
+	libagdb_io_handle_t *io_handle                           = NULL;
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libfdata_list_t *compressed_blocks_list                  = NULL;
+	uint8_t *data                                            = NULL;
+	size_t data_offset                                       = 0;
+	size_t data_size                                         = 0;
+	int block_index                                          = 0;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 * The LZNT1 compressed data consists of 3 blocks, each an uncompressed chunk of 16 bytes
+	 */
+	data_size = 3 * ( 2 + 16 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( block_index = 0;
+	     block_index < 3;
+	     block_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data[ data_offset ] ),
+		 0x300f );
+
+		data_offset += 2;
+
+		result = memory_set(
+		          &( data[ data_offset ] ),
+		          'a' + block_index,
+		          16 ) != NULL;
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		data_offset += 16;
+	}
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type               = LIBAGDB_FILE_TYPE_COMPRESSED_VISTA;
+	io_handle->file_size               = (size64_t) data_size;
+	io_handle->uncompressed_block_size = 16;
+	io_handle->uncompressed_data_size  = 3 * 16;
+
+	result = libfdata_list_initialize(
+	          &compressed_blocks_list,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_blocks_list",
+	 compressed_blocks_list );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( block_index = 0;
+	     block_index < 3;
+	     block_index++ )
+	{
+		result = libfdata_list_append_element_with_mapped_size(
+		          compressed_blocks_list,
+		          &element_index,
+		          0,
+		          (off64_t) ( block_index * ( 2 + 16 ) ),
+		          (size64_t) ( 2 + 16 ),
+		          LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
+		          16,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          16,
+	          3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->compressed_block_pool = compressed_block_pool;
+
+	result = libagdb_compressed_block_cache_initialize(
+	          &compressed_block_cache,
+	          3,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_cache",
+	 compressed_block_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &first_compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_compressed_block",
+	 first_compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "first_compressed_block->data_size",
+	 first_compressed_block->data_size,
+	 (size_t) 16 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "first_compressed_block->data[ 0 ]",
+	 first_compressed_block->data[ 0 ],
+	 (uint8_t) 'a' );
+
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          &evicted_compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "evicted_compressed_block",
+	 evicted_compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_pool->number_of_free_blocks",
+	 compressed_block_pool->number_of_free_blocks,
+	 1 );
+
+	/* Read the first block again so that the second block becomes the least recently used
+	 */
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_block",
+	 (intptr_t *) compressed_block,
+	 (intptr_t *) first_compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_hits",
+	 io_handle->statistics.number_of_cache_hits,
+	 (uint64_t) 1 );
+
+	/* Read a block beyond the maximum number of entries
+	 */
+	compressed_block = NULL;
+
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block",
+	 compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_block->data[ 0 ]",
+	 compressed_block->data[ 0 ],
+	 (uint8_t) 'c' );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_cache->number_of_entries",
+	 compressed_block_cache->number_of_entries,
+	 2 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_misses",
+	 io_handle->statistics.number_of_cache_misses,
+	 (uint64_t) 3 );
+
+	/* The least recently used block was evicted and returned to the pool
+	 */
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_pool->number_of_free_blocks",
+	 compressed_block_pool->number_of_free_blocks,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_block_pool->free_blocks[ 0 ]",
+	 (intptr_t *) compressed_block_pool->free_blocks[ 0 ],
+	 (intptr_t *) evicted_compressed_block );
+
+	compressed_block = NULL;
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          1,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_cache_get_block(
+	          compressed_block_cache,
+	          0,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_block",
+	 (intptr_t *) compressed_block,
+	 (intptr_t *) first_compressed_block );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_block = NULL;
+
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_cache_read_block(
+	          compressed_block_cache,
+	          compressed_blocks_list,
+	          io_handle,
+	          file_io_handle,
+	          3,
+	          &compressed_block,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_compressed_block_cache_free(
+	          &compressed_block_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_pool->number_of_free_blocks",
+	 compressed_block_pool->number_of_free_blocks,
+	 3 );
+
+	io_handle->compressed_block_pool = NULL;
+
+	result = libagdb_compressed_block_pool_free(
+	          &compressed_block_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_free(
+	          &compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block_cache != NULL )
+	{
+		libagdb_compressed_block_cache_free(
+		 &compressed_block_cache,
+		 NULL );
+	}
+	if( compressed_block_pool != NULL )
+	{
+		libagdb_compressed_block_pool_free(
+		 &compressed_block_pool,
+		 NULL );
+	}
+	if( compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &compressed_blocks_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_cache_initialize",
+	 agdb_test_compressed_block_cache_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_cache_free",
+	 agdb_test_compressed_block_cache_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_cache_set_block",
+	 agdb_test_compressed_block_cache_set_block );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_cache_remove_block",
+	 agdb_test_compressed_block_cache_remove_block );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_cache_read_block",
+	 agdb_test_compressed_block_cache_read_block );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
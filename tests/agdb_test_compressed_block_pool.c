@@ -0,0 +1,752 @@
+/*
+ * Library compressed_block_pool type test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_compressed_block.h"
+#include "../libagdb/libagdb_compressed_block_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_compressed_block_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_pool_initialize(
+     void )
+{
+	libagdb_compressed_block_pool_t *compressed_block_pool = NULL;
+	libcerror_error_t *error                               = NULL;
+	int result                                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          4096,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_pool_free(
+	          &compressed_block_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_pool_initialize(
+	          NULL,
+	          4096,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          0,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          4096,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block_pool != NULL )
+	{
+		libagdb_compressed_block_pool_free(
+		 &compressed_block_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_pool_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_pool_get_block function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_pool_get_block(
+     void )
+{
+	libagdb_compressed_block_t *compressed_block1          = NULL;
+	libagdb_compressed_block_t *compressed_block2          = NULL;
+	libagdb_compressed_block_t *compressed_block3          = NULL;
+	libagdb_compressed_block_pool_t *compressed_block_pool = NULL;
+	libcerror_error_t *error                               = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          4096,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_pool_get_block(
+	          compressed_block_pool,
+	          4096,
+	          &compressed_block1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block1",
+	 compressed_block1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_block1->data_size",
+	 compressed_block1->data_size,
+	 (size_t) 4096 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_pool_get_block(
+	          compressed_block_pool,
+	          1024,
+	          &compressed_block2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block2",
+	 compressed_block2 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_block2->data_size",
+	 compressed_block2->data_size,
+	 (size_t) 1024 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The pool is exhausted, the block is allocated separately
+	 */
+	result = libagdb_compressed_block_pool_get_block(
+	          compressed_block_pool,
+	          4096,
+	          &compressed_block3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block3",
+	 compressed_block3 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block3->pool",
+	 compressed_block3->pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Releases the blocks back into the pool
+	 */
+	result = libagdb_compressed_block_free(
+	          &compressed_block1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block1",
+	 compressed_block1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_free(
+	          &compressed_block2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_free(
+	          &compressed_block3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "compressed_block_pool->number_of_free_blocks",
+	 compressed_block_pool->number_of_free_blocks,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_pool_get_block(
+	          NULL,
+	          4096,
+	          &compressed_block1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_get_block(
+	          compressed_block_pool,
+	          0,
+	          &compressed_block1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_get_block(
+	          compressed_block_pool,
+	          4096,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_compressed_block_pool_free(
+	          &compressed_block_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block3 != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block3,
+		 NULL );
+	}
+	if( compressed_block2 != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block2,
+		 NULL );
+	}
+	if( compressed_block1 != NULL )
+	{
+		libagdb_compressed_block_free(
+		 &compressed_block1,
+		 NULL );
+	}
+	if( compressed_block_pool != NULL )
+	{
+		libagdb_compressed_block_pool_free(
+		 &compressed_block_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compressed_block_pool_get_compressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compressed_block_pool_get_compressed_data(
+     void )
+{
+	libagdb_compressed_block_pool_t *compressed_block_pool = NULL;
+	libcerror_error_t *error                               = NULL;
+	uint8_t *compressed_data                               = NULL;
+	uint8_t *first_compressed_data                         = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_compressed_block_pool_initialize(
+	          &compressed_block_pool,
+	          4096,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          4096,
+	          &first_compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_compressed_data",
+	 first_compressed_data );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_block_pool->compressed_data_size",
+	 compressed_block_pool->compressed_data_size,
+	 (size_t) 4096 );
+
+	/* The compressed data is reused for an equal or smaller size
+	 */
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          4096,
+	          &compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_data",
+	 (intptr_t *) compressed_data,
+	 (intptr_t *) first_compressed_data );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          1024,
+	          &compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_data",
+	 (intptr_t *) compressed_data,
+	 (intptr_t *) first_compressed_data );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_block_pool->compressed_data_size",
+	 compressed_block_pool->compressed_data_size,
+	 (size_t) 4096 );
+
+	/* The compressed data grows for a larger size
+	 */
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          65536,
+	          &compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_data",
+	 (intptr_t *) compressed_data,
+	 (intptr_t *) compressed_block_pool->compressed_data );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_block_pool->compressed_data_size",
+	 compressed_block_pool->compressed_data_size,
+	 (size_t) 65536 );
+
+	/* The last byte of the grown compressed data can be written
+	 */
+	compressed_data[ 65535 ] = 0xff;
+
+	/* Test error cases
+	 */
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          NULL,
+	          4096,
+	          &compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          0,
+	          &compressed_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compressed_block_pool_get_compressed_data(
+	          compressed_block_pool,
+	          4096,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_compressed_block_pool_free(
+	          &compressed_block_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "compressed_block_pool",
+	 compressed_block_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_block_pool != NULL )
+	{
+		libagdb_compressed_block_pool_free(
+		 &compressed_block_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_pool_initialize",
+	 agdb_test_compressed_block_pool_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_pool_free",
+	 agdb_test_compressed_block_pool_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_pool_get_block",
+	 agdb_test_compressed_block_pool_get_block );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compressed_block_pool_get_compressed_data",
+	 agdb_test_compressed_block_pool_get_compressed_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +38,7 @@
 #include "agdb_test_libcerror.h"
 #include "agdb_test_macros.h"
 #include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
 
 #include "../libagdb/libagdb_file.h"
 
@@ -422,35 +424,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_open function
+/* Tests the libagdb_file_set_number_of_decompression_threads function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_open(
-     const system_character_t *source )
+int agdb_test_file_set_number_of_decompression_threads(
+     void )
 {
-	char narrow_source[ 256 ];
-
 	libagdb_file_t *file     = NULL;
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = agdb_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libagdb_file_initialize(
 	          &file,
 	          &error );
@@ -468,12 +453,11 @@ int agdb_test_file_open(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libagdb_file_open(
+	result = libagdb_file_set_number_of_decompression_threads(
 	          file,
-	          narrow_source,
-	          LIBAGDB_OPEN_READ,
+	          4,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -485,30 +469,25 @@ int agdb_test_file_open(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_open(
-	          NULL,
-	          narrow_source,
-	          LIBAGDB_OPEN_READ,
+	result = libagdb_file_set_number_of_decompression_threads(
+	          file,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_open(
-	          file,
+	/* Test error cases
+	 */
+	result = libagdb_file_set_number_of_decompression_threads(
 	          NULL,
-	          LIBAGDB_OPEN_READ,
+	          4,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -523,9 +502,8 @@ int agdb_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_open(
+	result = libagdb_file_set_number_of_decompression_threads(
 	          file,
-	          narrow_source,
 	          -1,
 	          &error );
 
@@ -541,26 +519,6 @@ int agdb_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libagdb_file_open(
-	          file,
-	          narrow_source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
 	/* Clean up
 	 */
 	result = libagdb_file_free(
@@ -597,37 +555,18 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libagdb_file_open_wide function
+/* Tests the libagdb_file_set_mam_checkpoint_interval function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_open_wide(
-     const system_character_t *source )
+int agdb_test_file_set_mam_checkpoint_interval(
+     void )
 {
-	wchar_t wide_source[ 256 ];
-
 	libagdb_file_t *file     = NULL;
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = agdb_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libagdb_file_initialize(
 	          &file,
 	          &error );
@@ -645,12 +584,11 @@ int agdb_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libagdb_file_open_wide(
+	result = libagdb_file_set_mam_checkpoint_interval(
 	          file,
-	          wide_source,
-	          LIBAGDB_OPEN_READ,
+	          4 * 1024 * 1024,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -662,48 +600,25 @@ int agdb_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_open_wide(
+	result = libagdb_file_set_mam_checkpoint_interval(
 	          file,
-	          NULL,
-	          LIBAGDB_OPEN_READ,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_open_wide(
-	          file,
-	          wide_source,
-	          -1,
+	/* Test error cases
+	 */
+	result = libagdb_file_set_mam_checkpoint_interval(
+	          NULL,
+	          4 * 1024 * 1024,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -718,12 +633,9 @@ int agdb_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libagdb_file_open_wide(
+	result = libagdb_file_set_mam_checkpoint_interval(
 	          file,
-	          wide_source,
-	          LIBAGDB_OPEN_READ,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -774,64 +686,18 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libagdb_file_open_file_io_handle function
+/* Tests the libagdb_file_set_maximum_cache_entries function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_open_file_io_handle(
-     const system_character_t *source )
+int agdb_test_file_set_maximum_cache_entries(
+     void )
 {
-	libagdb_file_t *file             = NULL;
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libagdb_file_initialize(
 	          &file,
 	          &error );
@@ -849,12 +715,11 @@ int agdb_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libagdb_file_open_file_io_handle(
+	result = libagdb_file_set_maximum_cache_entries(
 	          file,
-	          file_io_handle,
-	          LIBAGDB_OPEN_READ,
+	          64,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -866,48 +731,25 @@ int agdb_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_open_file_io_handle(
-	          NULL,
-	          file_io_handle,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_open_file_io_handle(
+	result = libagdb_file_set_maximum_cache_entries(
 	          file,
-	          NULL,
-	          LIBAGDB_OPEN_READ,
+	          1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_open_file_io_handle(
-	          file,
-	          file_io_handle,
-	          -1,
+	/* Test error cases
+	 */
+	result = libagdb_file_set_maximum_cache_entries(
+	          NULL,
+	          64,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -922,12 +764,9 @@ int agdb_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libagdb_file_open_file_io_handle(
+	result = libagdb_file_set_maximum_cache_entries(
 	          file,
-	          file_io_handle,
-	          LIBAGDB_OPEN_READ,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -961,24 +800,7 @@ int agdb_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	return( 1 );
+	return( 1 );
 
 on_error:
 	if( error != NULL )
@@ -992,58 +814,14 @@ on_error:
 		 &file,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libagdb_file_close function
+/* Tests the libagdb_file_set_cache_policy function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_close(
+int agdb_test_file_set_cache_policy(
      void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test error cases
-	 */
-	result = libagdb_file_close(
-	          NULL,
-	          &error );
-
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libagdb_file_open and libagdb_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_open_close(
-     const system_character_t *source )
 {
 	libagdb_file_t *file     = NULL;
 	libcerror_error_t *error = NULL;
@@ -1068,21 +846,12 @@ int agdb_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test regular cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libagdb_file_open_wide(
+	result = libagdb_file_set_cache_policy(
 	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-#else
-	result = libagdb_file_open(
-	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
+	          LIBAGDB_CACHE_POLICY_LEAST_RECENTLY_USED,
 	          &error );
-#endif
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1093,57 +862,56 @@ int agdb_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libagdb_file_close(
+	result = libagdb_file_set_cache_policy(
 	          file,
+	          LIBAGDB_CACHE_POLICY_PIN_ALL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libagdb_file_open_wide(
-	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-#else
-	result = libagdb_file_open(
-	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
+	result = libagdb_file_set_cache_policy(
+	          NULL,
+	          LIBAGDB_CACHE_POLICY_LEAST_RECENTLY_USED,
 	          &error );
-#endif
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libagdb_file_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_set_cache_policy(
 	          file,
+	          -1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libagdb_file_free(
@@ -1180,19 +948,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_signal_abort function
+/* Tests the libagdb_file_set_number_of_read_ahead_blocks function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_signal_abort(
-     libagdb_file_t *file )
+int agdb_test_file_set_number_of_read_ahead_blocks(
+     void )
 {
+	libagdb_file_t *file     = NULL;
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libagdb_file_signal_abort(
-	          file,
+	result = libagdb_file_initialize(
+	          &file,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1200,54 +969,33 @@ int agdb_test_file_signal_abort(
 	 result,
 	 1 );
 
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libagdb_file_signal_abort(
-	          NULL,
+	result = libagdb_file_set_number_of_read_ahead_blocks(
+	          file,
+	          4,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libagdb_file_get_number_of_volumes function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_get_number_of_volumes(
-     libagdb_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_volumes    = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libagdb_file_get_number_of_volumes(
+	result = libagdb_file_set_number_of_read_ahead_blocks(
 	          file,
-	          &number_of_volumes,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1261,9 +1009,9 @@ int agdb_test_file_get_number_of_volumes(
 
 	/* Test error cases
 	 */
-	result = libagdb_file_get_number_of_volumes(
+	result = libagdb_file_set_number_of_read_ahead_blocks(
 	          NULL,
-	          &number_of_volumes,
+	          4,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1278,9 +1026,9 @@ int agdb_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_number_of_volumes(
+	result = libagdb_file_set_number_of_read_ahead_blocks(
 	          file,
-	          NULL,
+	          -1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1295,6 +1043,25 @@ int agdb_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1303,25 +1070,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libagdb_file_get_volume_information function
+/* Tests the libagdb_file_set_time_budget function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_get_volume_information(
-     libagdb_file_t *file )
+int agdb_test_file_set_time_budget(
+     void )
 {
-	libagdb_volume_information_t *volume_information = 0;
-	libcerror_error_t *error                         = NULL;
-	int number_of_volumes                            = 0;
-	int result                                       = 0;
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libagdb_file_get_number_of_volumes(
-	          file,
-	          &number_of_volumes,
+	result = libagdb_file_initialize(
+	          &file,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1329,20 +1100,19 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 1 );
 
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_volumes == 0 )
-	{
-		return( 1 );
-	}
 	/* Test regular cases
 	 */
-	result = libagdb_file_get_volume_information(
+	result = libagdb_file_set_time_budget(
 	          file,
-	          0,
-	          &volume_information,
+	          1000,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1354,12 +1124,9 @@ int agdb_test_file_get_volume_information(
 	 "error",
 	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_information",
-	 volume_information );
-
-	result = libagdb_volume_information_free(
-	          &volume_information,
+	result = libagdb_file_set_time_budget(
+	          file,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1373,10 +1140,9 @@ int agdb_test_file_get_volume_information(
 
 	/* Test error cases
 	 */
-	result = libagdb_file_get_volume_information(
+	result = libagdb_file_set_time_budget(
 	          NULL,
-	          0,
-	          &volume_information,
+	          1000,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1384,10 +1150,6 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1395,10 +1157,9 @@ int agdb_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_volume_information(
+	result = libagdb_file_set_time_budget(
 	          file,
-	          -1,
-	          &volume_information,
+	          (uint64_t) UINT64_MAX,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1406,10 +1167,6 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1417,20 +1174,2320 @@ int agdb_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_volume_information(
-	          file,
-	          0,
-	          NULL,
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_set_verify_hashes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_set_verify_hashes(
+     void )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_set_verify_hashes(
+	          file,
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_set_verify_hashes(
+	          file,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_set_verify_hashes(
+	          NULL,
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libagdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_open(
+	          NULL,
+	          narrow_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open(
+	          file,
+	          NULL,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open(
+	          file,
+	          narrow_source,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libagdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libagdb_file_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libagdb_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_wide(
+	          file,
+	          NULL,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_wide(
+	          file,
+	          wide_source,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libagdb_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libagdb_file_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open_file_io_handle(
+     const system_character_t *source )
+{
+	libagdb_file_t *file             = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          NULL,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBAGDB_OPEN_READ | LIBAGDB_ACCESS_FLAG_MEMORY_MAP,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open_memory(
+     const system_character_t *source )
+{
+	libagdb_file_t *file             = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *data                    = NULL;
+	size64_t file_size               = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open when already opened
+	 */
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_open_memory(
+	          NULL,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          NULL,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          0,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_file_close(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_open and libagdb_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open_close(
+     const system_character_t *source )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with the file read into memory
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ | LIBAGDB_ACCESS_FLAG_READ_INTO_MEMORY,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ | LIBAGDB_ACCESS_FLAG_READ_INTO_MEMORY,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with read-ahead of the compressed blocks
+	 */
+	result = libagdb_file_set_number_of_read_ahead_blocks(
+	          file,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_signal_abort(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_signal_abort(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The abort also applies to an activity that starts after it was signalled
+	 */
+	if( number_of_volumes > 0 )
+	{
+		result = libagdb_file_scan(
+		          file,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+	/* Test error cases
+	 */
+	result = libagdb_file_signal_abort(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_number_of_volumes(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          NULL,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_volume_information function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_volume_information(
+     libagdb_file_t *file )
+{
+	libagdb_volume_information_t *volume_information = 0;
+	libcerror_error_t *error                         = NULL;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_volumes == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_volume_information(
+	          file,
+	          0,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	result = libagdb_volume_information_free(
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_volume_information(
+	          NULL,
+	          0,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_information(
+	          file,
+	          -1,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_information(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_number_of_sources function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_number_of_sources(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_sources    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          NULL,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_source_information function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_source_information(
+     libagdb_file_t *file )
+{
+	libagdb_source_information_t *source_information = 0;
+	libcerror_error_t *error                         = NULL;
+	int number_of_sources                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_source_information(
+	          file,
+	          0,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_information",
+	 source_information );
+
+	result = libagdb_source_information_free(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_source_information(
+	          NULL,
+	          0,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_information(
+	          file,
+	          -1,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_information(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_source_information_by_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_source_information_by_prefetch_hash(
+     libagdb_file_t *file )
+{
+	libagdb_source_information_t *source_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint32_t prefetch_hash                           = 0;
+	uint32_t source_prefetch_hash                    = 0;
+	int expected_result                              = 0;
+	int number_of_sources                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	result = libagdb_file_get_source_information(
+	          file,
+	          number_of_sources - 1,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_result = libagdb_source_information_get_prefetch_hash(
+	                   source_information,
+	                   &prefetch_hash,
+	                   &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_source_information_free(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_source_information_by_prefetch_hash(
+	          file,
+	          prefetch_hash,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 1 )
+	{
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "source_information",
+		 source_information );
+
+		result = libagdb_source_information_get_prefetch_hash(
+		          source_information,
+		          &source_prefetch_hash,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "source_prefetch_hash",
+		 source_prefetch_hash,
+		 prefetch_hash );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_source_information_free(
+		          &source_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libagdb_file_get_source_information_by_prefetch_hash(
+	          NULL,
+	          prefetch_hash,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_information_by_prefetch_hash(
+	          file,
+	          prefetch_hash,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_statistics(
+     libagdb_file_t *file )
+{
+	libagdb_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_statistics(
+	          file,
+	          &statistics,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file header and records have been read by the preceding tests
+	 */
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_file_reads",
+	 (int64_t) statistics.number_of_file_reads,
+	 (int64_t) 0 );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.file_read_size",
+	 (int64_t) statistics.file_read_size,
+	 (int64_t) 0 );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_stream_reads",
+	 (int64_t) statistics.number_of_stream_reads,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_statistics(
+	          NULL,
+	          &statistics,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_statistics(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_peek_data and libagdb_file_release_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_peek_data(
+     libagdb_file_t *file )
+{
+	const uint8_t *data      = NULL;
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_peek_data(
+	          file,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "data_size",
+	 (ssize_t) data_size,
+	 (ssize_t) 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_peek_data(
+	          file,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_release_data(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_peek_data(
+	          NULL,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_peek_data(
+	          file,
+	          -1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_peek_data(
+	          file,
+	          0,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_peek_data(
+	          file,
+	          0,
+	          &data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_release_data(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1450,18 +3507,109 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_get_number_of_sources function
+/* Counts the records provided by libagdb_file_scan
+ */
+typedef struct agdb_test_file_scan_counts agdb_test_file_scan_counts_t;
+
+struct agdb_test_file_scan_counts
+{
+	int number_of_volumes;
+	int number_of_files;
+	int number_of_sources;
+	int stop_after_first_volume;
+};
+
+/* Volume callback for the libagdb_file_scan test
+ * Returns 1 to continue or 0 to stop
+ */
+int agdb_test_file_scan_volume_callback(
+     libagdb_volume_information_t *volume_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int volume_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	agdb_test_file_scan_counts_t *counts = (agdb_test_file_scan_counts_t *) user_data;
+
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_index )
+
+	counts->number_of_volumes += 1;
+
+	if( counts->stop_after_first_volume != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* File callback for the libagdb_file_scan test
+ * Returns 1 to continue
+ */
+int agdb_test_file_scan_file_callback(
+     libagdb_volume_information_t *volume_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int volume_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     libagdb_file_information_t *file_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int file_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	agdb_test_file_scan_counts_t *counts = (agdb_test_file_scan_counts_t *) user_data;
+
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( volume_index )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_index )
+
+	counts->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Source callback for the libagdb_file_scan test
+ * Returns 1 to continue
+ */
+int agdb_test_file_scan_source_callback(
+     libagdb_source_information_t *source_information AGDB_TEST_ATTRIBUTE_UNUSED,
+     int source_index AGDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	agdb_test_file_scan_counts_t *counts = (agdb_test_file_scan_counts_t *) user_data;
+
+	AGDB_TEST_UNREFERENCED_PARAMETER( source_information )
+	AGDB_TEST_UNREFERENCED_PARAMETER( source_index )
+
+	counts->number_of_sources += 1;
+
+	return( 1 );
+}
+
+/* Tests the libagdb_file_scan function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_get_number_of_sources(
+int agdb_test_file_scan(
      libagdb_file_t *file )
 {
+	agdb_test_file_scan_counts_t counts;
+
 	libcerror_error_t *error = NULL;
 	int number_of_sources    = 0;
+	int number_of_volumes    = 0;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_file_get_number_of_sources(
 	          file,
 	          &number_of_sources,
@@ -1476,28 +3624,105 @@ int agdb_test_file_get_number_of_sources(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libagdb_file_get_number_of_sources(
-	          NULL,
-	          &number_of_sources,
+	memory_set(
+	 &counts,
+	 0,
+	 sizeof( agdb_test_file_scan_counts_t ) );
+
+	result = libagdb_file_scan(
+	          file,
+	          &agdb_test_file_scan_volume_callback,
+	          &agdb_test_file_scan_file_callback,
+	          &agdb_test_file_scan_source_callback,
+	          (void *) &counts,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_volumes",
+	 counts.number_of_volumes,
+	 number_of_volumes );
 
-	result = libagdb_file_get_number_of_sources(
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_sources",
+	 counts.number_of_sources,
+	 number_of_sources );
+
+	/* Test scan without callbacks
+	 */
+	result = libagdb_file_scan(
 	          file,
 	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan stopped by a callback
+	 */
+	if( number_of_volumes > 0 )
+	{
+		memory_set(
+		 &counts,
+		 0,
+		 sizeof( agdb_test_file_scan_counts_t ) );
+
+		counts.stop_after_first_volume = 1;
+
+		result = libagdb_file_scan(
+		          file,
+		          &agdb_test_file_scan_volume_callback,
+		          NULL,
+		          &agdb_test_file_scan_source_callback,
+		          (void *) &counts,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "counts.number_of_volumes",
+		 counts.number_of_volumes,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "counts.number_of_sources",
+		 counts.number_of_sources,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libagdb_file_scan(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1523,22 +3748,53 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_get_source_information function
+/* Records the progress provided to the progress callback
+ */
+typedef struct agdb_test_file_progress agdb_test_file_progress_t;
+
+struct agdb_test_file_progress
+{
+	int number_of_calls;
+	uint32_t number_of_parsed_volumes;
+	int cancel;
+};
+
+/* Progress callback for the libagdb_file_set_progress_callback test
+ * Returns 0 to continue or 1 to cancel
+ */
+int agdb_test_file_progress_callback(
+     const libagdb_progress_t *progress,
+     void *user_data )
+{
+	agdb_test_file_progress_t *test_progress = (agdb_test_file_progress_t *) user_data;
+
+	test_progress->number_of_calls         += 1;
+	test_progress->number_of_parsed_volumes = progress->number_of_parsed_volumes;
+
+	if( test_progress->cancel != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_set_progress_callback function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_get_source_information(
+int agdb_test_file_set_progress_callback(
      libagdb_file_t *file )
 {
-	libagdb_source_information_t *source_information = 0;
-	libcerror_error_t *error                         = NULL;
-	int number_of_sources                            = 0;
-	int result                                       = 0;
+	agdb_test_file_progress_t test_progress;
+
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libagdb_file_get_number_of_sources(
+	result = libagdb_file_get_number_of_volumes(
 	          file,
-	          &number_of_sources,
+	          &number_of_volumes,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1550,16 +3806,17 @@ int agdb_test_file_get_source_information(
 	 "error",
 	 error );
 
-	if( number_of_sources == 0 )
-	{
-		return( 1 );
-	}
 	/* Test regular cases
 	 */
-	result = libagdb_file_get_source_information(
+	memory_set(
+	 &test_progress,
+	 0,
+	 sizeof( agdb_test_file_progress_t ) );
+
+	result = libagdb_file_set_progress_callback(
 	          file,
-	          0,
-	          &source_information,
+	          &agdb_test_file_progress_callback,
+	          (void *) &test_progress,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1571,12 +3828,12 @@ int agdb_test_file_get_source_information(
 	 "error",
 	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "source_information",
-	 source_information );
-
-	result = libagdb_source_information_free(
-	          &source_information,
+	result = libagdb_file_scan(
+	          file,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1588,56 +3845,68 @@ int agdb_test_file_get_source_information(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_get_source_information(
-	          NULL,
-	          0,
-	          &source_information,
-	          &error );
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "test_progress.number_of_parsed_volumes",
+	 test_progress.number_of_parsed_volumes,
+	 (uint32_t) number_of_volumes );
 
-	AGDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	/* Test cancellation by the progress callback
+	 */
+	if( number_of_volumes > 0 )
+	{
+		memory_set(
+		 &test_progress,
+		 0,
+		 sizeof( agdb_test_file_progress_t ) );
+
+		test_progress.cancel = 1;
+
+		result = libagdb_file_scan(
+		          file,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &error );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		libcerror_error_free(
+		 &error );
 
-	result = libagdb_file_get_source_information(
+		AGDB_TEST_ASSERT_GREATER_THAN_INT(
+		 "test_progress.number_of_calls",
+		 test_progress.number_of_calls,
+		 0 );
+	}
+	result = libagdb_file_set_progress_callback(
 	          file,
-	          -1,
-	          &source_information,
+	          NULL,
+	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
-
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_get_source_information(
-	          file,
-	          0,
+	/* Test error cases
+	 */
+	result = libagdb_file_set_progress_callback(
 	          NULL,
+	          &agdb_test_file_progress_callback,
+	          (void *) &test_progress,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1645,10 +3914,6 @@ int agdb_test_file_get_source_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1664,6 +3929,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libagdb_file_set_progress_callback(
+	 file,
+	 NULL,
+	 NULL,
+	 NULL );
+
 	return( 0 );
 }
 
@@ -1724,6 +3995,34 @@ int main(
 	 "libagdb_file_free",
 	 agdb_test_file_free );
 
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_number_of_decompression_threads",
+	 agdb_test_file_set_number_of_decompression_threads );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_mam_checkpoint_interval",
+	 agdb_test_file_set_mam_checkpoint_interval );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_maximum_cache_entries",
+	 agdb_test_file_set_maximum_cache_entries );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_cache_policy",
+	 agdb_test_file_set_cache_policy );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_number_of_read_ahead_blocks",
+	 agdb_test_file_set_number_of_read_ahead_blocks );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_time_budget",
+	 agdb_test_file_set_time_budget );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_verify_hashes",
+	 agdb_test_file_set_verify_hashes );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1803,6 +4102,11 @@ int main(
 		 agdb_test_file_open_file_io_handle,
 		 source );
 
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_open_memory",
+		 agdb_test_file_open_memory,
+		 source );
+
 		AGDB_TEST_RUN(
 		 "libagdb_file_close",
 		 agdb_test_file_close );
@@ -1832,11 +4136,6 @@ int main(
 		 "error",
 		 error );
 
-		AGDB_TEST_RUN_WITH_ARGS(
-		 "libagdb_file_signal_abort",
-		 agdb_test_file_signal_abort,
-		 file );
-
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
 
 		/* TODO: add tests for libagdb_file_open_read */
@@ -1863,6 +4162,38 @@ int main(
 		 agdb_test_file_get_source_information,
 		 file );
 
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_source_information_by_prefetch_hash",
+		 agdb_test_file_get_source_information_by_prefetch_hash,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_peek_data",
+		 agdb_test_file_peek_data,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_scan",
+		 agdb_test_file_scan,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_set_progress_callback",
+		 agdb_test_file_set_progress_callback,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_statistics",
+		 agdb_test_file_get_statistics,
+		 file );
+
+		/* A signalled abort applies until the file is closed
+		 */
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_signal_abort",
+		 agdb_test_file_signal_abort,
+		 file );
+
 		/* Clean up
 		 */
 		result = agdb_test_file_close_source(
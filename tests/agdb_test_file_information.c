@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -37,7 +38,9 @@
 #include "agdb_test_unused.h"
 
 #include "../libagdb/libagdb_file_information.h"
+#include "../libagdb/libagdb_file_table.h"
 #include "../libagdb/libagdb_io_handle.h"
+#include "../libagdb/libagdb_record_buffer.h"
 
 uint8_t agdb_test_file_information_data1[ 276 ] = {
 	0x69, 0x1a, 0xf9, 0x02, 0xa6, 0xa7, 0x28, 0xa1, 0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
@@ -59,6 +62,18 @@ uint8_t agdb_test_file_information_data1[ 276 ] = {
 	0x53, 0x00, 0x00, 0x00, 0xc1, 0x29, 0xf7, 0x02, 0x81, 0x00, 0x00, 0x00, 0xaa, 0x01, 0x09, 0x01,
         0x0f, 0x00, 0x67, 0x06 };
 
+/* ASCII path: \WINDOWS\AB
+ */
+uint8_t agdb_test_file_information_path_data1[ 24 ] = {
+	0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x53, 0x00,
+	0x5c, 0x00, 0x41, 0x00, 0x42, 0x00, 0x00, 0x00 };
+
+/* Non-ASCII path: \CAFE.TXT with U+00c9 as the E
+ */
+uint8_t agdb_test_file_information_path_data2[ 20 ] = {
+	0x5c, 0x00, 0x43, 0x00, 0x41, 0x00, 0x46, 0x00, 0xc9, 0x00, 0x2e, 0x00, 0x54, 0x00, 0x58, 0x00,
+	0x54, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
 
 /* Reads data from the current offset into a buffer
@@ -641,6 +656,144 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_file_information_check_sub_entry_sizes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_information_check_sub_entry_sizes(
+     void )
+{
+	libagdb_io_handle_t *io_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	io_handle->file_information_sub_entry_type1_size = 16;
+	io_handle->file_information_sub_entry_type2_size = 20;
+
+	result = libagdb_file_information_check_sub_entry_sizes(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_information_check_sub_entry_sizes(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->file_information_sub_entry_type1_size = 20;
+
+	result = libagdb_file_information_check_sub_entry_sizes(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->file_information_sub_entry_type1_size = 16;
+	io_handle->file_information_sub_entry_type2_size = 28;
+
+	result = libagdb_file_information_check_sub_entry_sizes(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libagdb_internal_file_information_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -649,9 +802,12 @@ int agdb_test_internal_file_information_read_file_io_handle(
 {
 	libagdb_file_information_t *file_information = NULL;
 	libagdb_io_handle_t *io_handle               = NULL;
+	libagdb_record_buffer_t *record_buffer       = NULL;
 	libbfio_handle_t *file_io_handle             = NULL;
 	libcerror_error_t *error                     = NULL;
 	libfdata_stream_t *data_stream               = NULL;
+	const uint8_t *sub_entries_data              = NULL;
+	size_t sub_entry_size                        = 0;
 	ssize64_t read_count                         = 0;
 	int element_index                            = 0;
 	int result                                   = 0;
@@ -679,6 +835,24 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_record_buffer_initialize(
+	          &record_buffer,
+	          1024,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_buffer",
+	 record_buffer );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfdata_stream_initialize(
 	          &data_stream,
 	          NULL,
@@ -765,6 +939,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              file_io_handle,
 	              0,
@@ -780,11 +958,51 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	 "error",
 	 error );
 
+	/* The sub entries are retained
+	 */
+	result = libagdb_file_information_get_sub_entries(
+	          file_information,
+	          &sub_entries_data,
+	          &sub_entry_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_entries_data",
+	 sub_entries_data );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "sub_entry_size",
+	 sub_entry_size,
+	 (size_t) 16 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sub_entries_data,
+	          &( agdb_test_file_information_data1[ 260 ] ),
+	          16 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              NULL,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              file_io_handle,
 	              0,
@@ -806,6 +1024,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              NULL,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              file_io_handle,
 	              0,
@@ -827,6 +1049,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              NULL,
 	              file_io_handle,
 	              0,
@@ -848,6 +1074,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              NULL,
 	              0,
@@ -869,6 +1099,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              file_io_handle,
 	              -1,
@@ -926,6 +1160,10 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	read_count = libagdb_internal_file_information_read_file_io_handle(
 	              (libagdb_internal_file_information_t *) file_information,
 	              io_handle,
+	              record_buffer,
+	              NULL,
+	              NULL,
+	              0,
 	              data_stream,
 	              file_io_handle,
 	              0,
@@ -993,6 +1231,23 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	 "error",
 	 error );
 
+	result = libagdb_record_buffer_free(
+	          &record_buffer,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "record_buffer",
+	 record_buffer );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_io_handle_free(
 	          &io_handle,
 	          &error );
@@ -1036,6 +1291,12 @@ on_error:
 		 &data_stream,
 		 NULL );
 	}
+	if( record_buffer != NULL )
+	{
+		libagdb_record_buffer_free(
+		 &record_buffer,
+		 NULL );
+	}
 	if( io_handle != NULL )
 	{
 		libagdb_io_handle_free(
@@ -1045,65 +1306,790 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_information_get_utf8_path_size function
+/* Tests the libagdb_file_information_read_record_size function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_information_get_utf8_path_size(
-     libagdb_file_information_t *file_information )
+int agdb_test_file_information_read_record_size(
+     void )
 {
-	libcerror_error_t *error  = NULL;
-	size_t utf8_path_size     = 0;
-	int result                = 0;
-	int utf8_path_size_is_set = 0;
+	libagdb_file_table_t *file_table       = NULL;
+	libagdb_io_handle_t *io_handle         = NULL;
+	libagdb_record_buffer_t *record_buffer = NULL;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *error               = NULL;
+	libfdata_stream_t *data_stream         = NULL;
+	size64_t record_size                   = 0;
+	int element_index                      = 0;
+	int result                             = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libagdb_file_information_get_utf8_path_size(
-	          file_information,
-	          &utf8_path_size,
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
-	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf8_path_size_is_set = result;
+	io_handle->file_information_entry_size           = 52;
+	io_handle->file_information_sub_entry_type1_size = 16;
+	io_handle->file_information_sub_entry_type2_size = 20;
 
-	/* Test error cases
-	 */
-	result = libagdb_file_information_get_utf8_path_size(
-	          NULL,
-	          &utf8_path_size,
+	result = libagdb_record_buffer_initialize(
+	          &record_buffer,
+	          1024,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_buffer",
+	 record_buffer );
+
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libagdb_file_table_initialize(
+	          &file_table,
+	          1,
+	          &error );
 
-	if( utf8_path_size_is_set != 0 )
-	{
-		result = libagdb_file_information_get_utf8_path_size(
-		          file_information,
-		          NULL,
-		          &error );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_initialize(
+	          &data_stream,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &agdb_test_file_information_read_segment_data,
+	          NULL,
+	          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &agdb_test_file_information_seek_segment_offset,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_stream",
+	 data_stream );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_append_segment(
+	          data_stream,
+	          &element_index,
+	          0,
+	          0,
+	          276,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          agdb_test_file_information_data1,
+	          276,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_information_read_record_size(
+	          io_handle,
+	          record_buffer,
+	          data_stream,
+	          file_io_handle,
+	          0,
+	          0,
+	          &record_size,
+	          file_table,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "record_size",
+	 (uint64_t) record_size,
+	 (uint64_t) 276 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "file_table->number_of_set_files",
+	 file_table->number_of_set_files,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "file_table->name_hashes[ 0 ]",
+	 file_table->name_hashes[ 0 ],
+	 (uint32_t) 0xa128a7a6UL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "file_table->number_of_entries[ 0 ]",
+	 file_table->number_of_entries[ 0 ],
+	 (uint32_t) 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "file_table->path_offsets[ 0 ]",
+	 (int64_t) file_table->path_offsets[ 0 ],
+	 (int64_t) 52 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "file_table->path_sizes[ 0 ]",
+	 file_table->path_sizes[ 0 ],
+	 (uint32_t) 208 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_information_read_record_size(
+	          NULL,
+	          record_buffer,
+	          data_stream,
+	          file_io_handle,
+	          0,
+	          1,
+	          &record_size,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_read_record_size(
+	          io_handle,
+	          record_buffer,
+	          data_stream,
+	          file_io_handle,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_read_record_size(
+	          io_handle,
+	          record_buffer,
+	          data_stream,
+	          file_io_handle,
+	          -1,
+	          1,
+	          &record_size,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_table_free(
+	          &file_table,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_record_buffer_free(
+	          &record_buffer,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "record_buffer",
+	 record_buffer );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( file_table != NULL )
+	{
+		libagdb_file_table_free(
+		 &file_table,
+		 NULL );
+	}
+	if( record_buffer != NULL )
+	{
+		libagdb_record_buffer_free(
+		 &record_buffer,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_internal_file_information_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_internal_file_information_get_utf8_path_size(
+     void )
+{
+	uint8_t utf8_path[ 64 ];
+
+	uint8_t expected_utf8_path1[ 12 ] = {
+		'\\', 'W', 'I', 'N', 'D', 'O', 'W', 'S', '\\', 'A', 'B', 0 };
+
+	uint8_t expected_utf8_path2[ 11 ] = {
+		'\\', 'C', 'A', 'F', 0xc3, 0x89, '.', 'T', 'X', 'T', 0 };
+
+	libagdb_file_information_t *file_information = NULL;
+	libcerror_error_t *error                     = NULL;
+	size_t utf8_path_size                        = 0;
+	int result                                   = 0;
+
+	/* Test regular cases with an ASCII path
+	 */
+	result = libagdb_file_information_initialize(
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libagdb_internal_file_information_t *) file_information )->path_size = 24;
+
+	result = libagdb_internal_file_information_read_path_data(
+	          (libagdb_internal_file_information_t *) file_information,
+	          agdb_test_file_information_path_data1,
+	          24,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_internal_file_information_get_utf8_path_size(
+	          (libagdb_internal_file_information_t *) file_information,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 12 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "path_is_ascii",
+	 ( (libagdb_internal_file_information_t *) file_information )->path_is_ascii,
+	 (uint8_t) 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cached size is returned on subsequent calls
+	 */
+	result = libagdb_internal_file_information_get_utf8_path_size(
+	          (libagdb_internal_file_information_t *) file_information,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 12 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_information_get_utf8_path(
+	          file_information,
+	          utf8_path,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path1,
+	          12 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libagdb_file_information_get_utf8_path(
+	          file_information,
+	          utf8_path,
+	          12 - 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_internal_file_information_free(
+	          (libagdb_internal_file_information_t **) &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a non-ASCII path
+	 */
+	result = libagdb_file_information_initialize(
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libagdb_internal_file_information_t *) file_information )->path_size = 20;
+
+	result = libagdb_internal_file_information_read_path_data(
+	          (libagdb_internal_file_information_t *) file_information,
+	          agdb_test_file_information_path_data2,
+	          20,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_internal_file_information_get_utf8_path_size(
+	          (libagdb_internal_file_information_t *) file_information,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 11 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "path_is_ascii",
+	 ( (libagdb_internal_file_information_t *) file_information )->path_is_ascii,
+	 (uint8_t) 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cached size is returned on subsequent calls
+	 */
+	result = libagdb_internal_file_information_get_utf8_path_size(
+	          (libagdb_internal_file_information_t *) file_information,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 11 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_information_get_utf8_path(
+	          file_information,
+	          utf8_path,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path2,
+	          11 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libagdb_file_information_get_utf8_path(
+	          file_information,
+	          utf8_path,
+	          11 - 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_internal_file_information_free(
+	          (libagdb_internal_file_information_t **) &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_internal_file_information_get_utf8_path_size(
+	          NULL,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_information != NULL )
+	{
+		libagdb_internal_file_information_free(
+		 (libagdb_internal_file_information_t **) &file_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_information_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_information_get_utf8_path_size(
+     libagdb_file_information_t *file_information )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf8_path_size     = 0;
+	int result                = 0;
+	int utf8_path_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_information_get_utf8_path_size(
+	          file_information,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_path_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libagdb_file_information_get_utf8_path_size(
+	          NULL,
+	          &utf8_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_path_size_is_set != 0 )
+	{
+		result = libagdb_file_information_get_utf8_path_size(
+		          file_information,
+		          NULL,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
 		AGDB_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -1437,6 +2423,179 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_file_information_get_number_of_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_information_get_number_of_sub_entries(
+     libagdb_file_information_t *file_information )
+{
+	libcerror_error_t *error  = NULL;
+	int number_of_sub_entries = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_information_get_number_of_sub_entries(
+	          file_information,
+	          &number_of_sub_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_entries",
+	 number_of_sub_entries,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_information_get_number_of_sub_entries(
+	          NULL,
+	          &number_of_sub_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_get_number_of_sub_entries(
+	          file_information,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_information_get_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_information_get_sub_entries(
+     libagdb_file_information_t *file_information )
+{
+	const uint8_t *sub_entries_data = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t sub_entry_size           = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_information_get_sub_entries(
+	          file_information,
+	          &sub_entries_data,
+	          &sub_entry_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_information_get_sub_entries(
+	          NULL,
+	          &sub_entries_data,
+	          &sub_entry_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_get_sub_entries(
+	          file_information,
+	          NULL,
+	          &sub_entry_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_get_sub_entries(
+	          file_information,
+	          &sub_entries_data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
 /* The main program
@@ -1485,10 +2644,22 @@ int main(
 	 "libagdb_internal_file_information_read_data",
 	 agdb_test_internal_file_information_read_data );
 
+	AGDB_TEST_RUN(
+	 "libagdb_file_information_check_sub_entry_sizes",
+	 agdb_test_file_information_check_sub_entry_sizes );
+
 	AGDB_TEST_RUN(
 	 "libagdb_internal_file_information_read_file_io_handle",
 	 agdb_test_internal_file_information_read_file_io_handle );
 
+	AGDB_TEST_RUN(
+	 "libagdb_file_information_read_record_size",
+	 agdb_test_file_information_read_record_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_internal_file_information_get_utf8_path_size",
+	 agdb_test_internal_file_information_get_utf8_path_size );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize file_information for tests
@@ -1582,6 +2753,16 @@ int main(
 	 agdb_test_file_information_get_utf16_path,
 	 file_information );
 
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_information_get_number_of_sub_entries",
+	 agdb_test_file_information_get_number_of_sub_entries,
+	 file_information );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_information_get_sub_entries",
+	 agdb_test_file_information_get_sub_entries,
+	 file_information );
+
 	/* Clean up
 	 */
 	result = libagdb_internal_file_information_free(
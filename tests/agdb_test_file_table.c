@@ -0,0 +1,520 @@
+/*
+ * Library file_table type test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_file_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_file_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_table_initialize(
+     void )
+{
+	libagdb_file_table_t *file_table = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 8;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_table_initialize(
+	          &file_table,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_table_free(
+	          &file_table,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_table_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_table = (libagdb_file_table_t *) 0x12345678UL;
+
+	result = libagdb_file_table_initialize(
+	          &file_table,
+	          4,
+	          &error );
+
+	file_table = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_table_initialize(
+	          &file_table,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_file_table_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_file_table_initialize(
+		          &file_table,
+		          4,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( file_table != NULL )
+			{
+				libagdb_file_table_free(
+				 &file_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "file_table",
+			 file_table );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_table != NULL )
+	{
+		libagdb_file_table_free(
+		 &file_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_file_table_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_table_set_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_table_set_entry(
+     void )
+{
+	libagdb_file_table_t *file_table = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_table_initialize(
+	          &file_table,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_table_set_entry(
+	          file_table,
+	          0,
+	          0,
+	          0xa128a7a6UL,
+	          0,
+	          3,
+	          52,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_table_set_entry(
+	          file_table,
+	          1,
+	          276,
+	          0x12345678UL,
+	          0,
+	          5,
+	          328,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "file_table->number_of_set_files",
+	 file_table->number_of_set_files,
+	 2 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "file_table->name_hashes[ 0 ]",
+	 file_table->name_hashes[ 0 ],
+	 (uint32_t) 0xa128a7a6UL );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "file_table->path_offsets[ 1 ]",
+	 (int64_t) file_table->path_offsets[ 1 ],
+	 (int64_t) 328 );
+
+	/* The first entry index is derived from the preceding entry
+	 */
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "file_table->first_entry_indexes[ 0 ]",
+	 file_table->first_entry_indexes[ 0 ],
+	 (uint64_t) 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "file_table->first_entry_indexes[ 1 ]",
+	 file_table->first_entry_indexes[ 1 ],
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_table_set_entry(
+	          NULL,
+	          2,
+	          0,
+	          0,
+	          0,
+	          0,
+	          52,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_table_set_entry(
+	          file_table,
+	          -1,
+	          0,
+	          0,
+	          0,
+	          0,
+	          52,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_table_set_entry(
+	          file_table,
+	          4,
+	          0,
+	          0,
+	          0,
+	          0,
+	          52,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The entries must be set in order
+	 */
+	result = libagdb_file_table_set_entry(
+	          file_table,
+	          3,
+	          0,
+	          0,
+	          0,
+	          0,
+	          52,
+	          208,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_table_free(
+	          &file_table,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_table",
+	 file_table );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_table != NULL )
+	{
+		libagdb_file_table_free(
+		 &file_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_table_initialize",
+	 agdb_test_file_table_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_table_free",
+	 agdb_test_file_table_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_table_set_entry",
+	 agdb_test_file_table_set_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,401 @@
+/*
+ * Library hash functions test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_hash.h"
+
+uint8_t agdb_test_hash_data1[ 54 ] = {
+	0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x53, 0x00,
+	0x5c, 0x00, 0x53, 0x00, 0x59, 0x00, 0x53, 0x00, 0x54, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x33, 0x00,
+	0x32, 0x00, 0x5c, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x2e, 0x00,
+	0x44, 0x00, 0x4c, 0x00, 0x4c, 0x00 };
+
+uint8_t agdb_test_hash_data2[ 16 ] = {
+	0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x53, 0x00 };
+
+uint8_t agdb_test_hash_data3[ 4 ] = {
+	0x5c, 0x00, 0x41, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_hash_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_hash_calculate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t hash_value      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_hash_calculate(
+	          &hash_value,
+	          agdb_test_hash_data1,
+	          54,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 (uint32_t) 0x27ea1ff4UL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_hash_calculate(
+	          &hash_value,
+	          agdb_test_hash_data2,
+	          16,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 (uint32_t) 0xa706a7d2UL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_hash_calculate(
+	          &hash_value,
+	          agdb_test_hash_data3,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 (uint32_t) 0x00004cb2fUL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_hash_calculate(
+	          NULL,
+	          agdb_test_hash_data1,
+	          54,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_hash_calculate(
+	          &hash_value,
+	          NULL,
+	          54,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_hash_calculate(
+	          &hash_value,
+	          agdb_test_hash_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_hash_calculate_multiple function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_hash_calculate_multiple(
+     void )
+{
+	const uint8_t *data[ 6 ] = {
+		agdb_test_hash_data1, agdb_test_hash_data2, agdb_test_hash_data3,
+		agdb_test_hash_data1, agdb_test_hash_data2, agdb_test_hash_data1 };
+
+	size_t data_sizes[ 6 ] = {
+		54, 16, 4, 0, 16, 54 };
+
+	uint32_t expected_hash_values[ 6 ] = {
+		0x27ea1ff4UL, 0xa706a7d2UL, 0x16925410UL, 0x00004cb2fUL, 0xa706a7d2UL, 0x27ea1ff4UL };
+
+	uint32_t hash_values[ 6 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          data,
+	          data_sizes,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "hash_values[ value_index ]",
+		 hash_values[ value_index ],
+		 expected_hash_values[ value_index ] );
+	}
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          data,
+	          data_sizes,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_hash_calculate_multiple(
+	          NULL,
+	          data,
+	          data_sizes,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          NULL,
+	          data_sizes,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          data,
+	          NULL,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          data,
+	          data_sizes,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 2 ] = NULL;
+
+	result = libagdb_hash_calculate_multiple(
+	          hash_values,
+	          data,
+	          data_sizes,
+	          6,
+	          &error );
+
+	data[ 2 ] = agdb_test_hash_data3;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_hash_calculate",
+	 agdb_test_hash_calculate );
+
+	AGDB_TEST_RUN(
+	 "libagdb_hash_calculate_multiple",
+	 agdb_test_hash_calculate_multiple );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
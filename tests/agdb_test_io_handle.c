@@ -20,19 +20,25 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "agdb_test_functions.h"
 #include "agdb_test_libagdb.h"
+#include "agdb_test_libbfio.h"
 #include "agdb_test_libcerror.h"
+#include "agdb_test_libfdata.h"
 #include "agdb_test_macros.h"
 #include "agdb_test_memory.h"
 #include "agdb_test_unused.h"
 
+#include "../libagdb/libagdb_compressed_block.h"
 #include "../libagdb/libagdb_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
@@ -301,6 +307,10 @@ int agdb_test_io_handle_clear(
 
 	/* Test regular cases
 	 */
+	io_handle->abort         = 1;
+	io_handle->time_budget   = 1000;
+	io_handle->verify_hashes = 1;
+
 	result = libagdb_io_handle_clear(
 	          io_handle,
 	          &error );
@@ -314,6 +324,21 @@ int agdb_test_io_handle_clear(
 	 "error",
 	 error );
 
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->abort",
+	 io_handle->abort,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->time_budget",
+	 io_handle->time_budget,
+	 (uint64_t) 1000 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->verify_hashes",
+	 io_handle->verify_hashes,
+	 (uint8_t) 1 );
+
 	/* Test error cases
 	 */
 	result = libagdb_io_handle_clear(
@@ -398,6 +423,563 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_io_handle_read_compressed_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_io_handle_read_compressed_blocks(
+     void )
+{
+	libagdb_io_handle_t *io_handle          = NULL;
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libfdata_list_element_t *list_element   = NULL;
+	libfdata_list_t *compressed_blocks_list = NULL;
+	uint8_t *data                           = NULL;
+	size64_t compressed_block_size          = 0;
+	off64_t compressed_block_offset         = 0;
+	size_t data_offset                      = 0;
+	size_t data_size                        = 0;
+	uint32_t compressed_block_flags         = 0;
+	int block_index                         = 0;
+	int compressed_block_file_index         = 0;
+	int number_of_elements                  = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 * The MEMO compressed data consists of 300 blocks, the header of block 256 crosses
+	 * the end of the first read window
+	 */
+	data_size = 8 + 3840 + ( 299 * 4097 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          0,
+	          data_size ) != NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data_offset = 8;
+
+	for( block_index = 0;
+	     block_index < 300;
+	     block_index++ )
+	{
+		if( block_index == 0 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 0x0efd );
+
+			data_offset += 3840;
+		}
+		else
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 0x0ffe );
+
+			data_offset += 4097;
+		}
+	}
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type               = LIBAGDB_FILE_TYPE_COMPRESSED_VISTA;
+	io_handle->file_size               = (size64_t) data_size;
+	io_handle->uncompressed_block_size = 4096;
+	io_handle->uncompressed_data_size  = 300 * 4096;
+
+	result = libfdata_list_initialize(
+	          &compressed_blocks_list,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_blocks_list",
+	 compressed_blocks_list );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_io_handle_read_compressed_blocks(
+	          io_handle,
+	          file_io_handle,
+	          compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          compressed_blocks_list,
+	          &number_of_elements,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 300 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_element_by_index(
+	          compressed_blocks_list,
+	          256,
+	          &list_element,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_element_get_data_range(
+	          list_element,
+	          &compressed_block_file_index,
+	          &compressed_block_offset,
+	          &compressed_block_size,
+	          &compressed_block_flags,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "compressed_block_offset",
+	 (int64_t) compressed_block_offset,
+	 (int64_t) ( 8 + 3840 + ( 255 * 4097 ) ) );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_block_size",
+	 (uint64_t) compressed_block_size,
+	 (uint64_t) 4097 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_free(
+	          &compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_io_handle_read_compressed_blocks(
+	          NULL,
+	          file_io_handle,
+	          compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compressed data is truncated within a block header
+	 */
+	io_handle->file_size = (size64_t) ( 8 + 3840 + 1 );
+
+	result = libfdata_list_initialize(
+	          &compressed_blocks_list,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_read_compressed_blocks(
+	          io_handle,
+	          file_io_handle,
+	          compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdata_list_free(
+	          &compressed_blocks_list,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &compressed_blocks_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_io_handle_get_mapped_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_io_handle_get_mapped_data(
+     void )
+{
+	uint8_t mapped_data[ 16 ];
+
+	const uint8_t *data            = NULL;
+	libagdb_io_handle_t *io_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->mapped_data      = mapped_data;
+	io_handle->mapped_data_size = 16;
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          12,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( mapped_data[ 12 ] ) ),
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_io_handle_get_mapped_data(
+	          NULL,
+	          0,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          4,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          -1,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          13,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	io_handle->mapped_data      = NULL;
+	io_handle->mapped_data_size = 0;
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
 /* The main program
@@ -429,10 +1011,16 @@ int main(
 	 "libagdb_io_handle_clear",
 	 agdb_test_io_handle_clear );
 
-	/* TODO: add tests for libagdb_io_handle_read_compressed_blocks */
+	AGDB_TEST_RUN(
+	 "libagdb_io_handle_read_compressed_blocks",
+	 agdb_test_io_handle_read_compressed_blocks );
 
 	/* TODO: add tests for libagdb_io_handle_read_uncompressed_file_header */
 
+	AGDB_TEST_RUN(
+	 "libagdb_io_handle_get_mapped_data",
+	 agdb_test_io_handle_get_mapped_data );
+
 	/* TODO: add tests for libagdb_io_handle_read_segment_data */
 
 	/* TODO: add tests for libagdb_io_handle_seek_segment_offset */
@@ -0,0 +1,815 @@
+/*
+ * Library mam_decoder type test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_functions.h"
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libbfio.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_mam_decoder.h"
+
+uint8_t agdb_test_mam_decoder_compressed_data1[ 285 ] = {
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x20, 0xe6, 0xc8, 0x31, 0xc2, 0xea, 0x84, 0x3a, 0x6c, 0x0d, 0x12, 0x33, 0x27, 0xbc, 0xa1,
+	0x79, 0xe4, 0x10, 0x10, 0xe2, 0x61, 0xee, 0x0a, 0x15, 0x00, 0x80, 0x00, 0x00 };
+
+uint8_t agdb_test_mam_decoder_uncompressed_data1[ 74 ] = {
+	0x41, 0x67, 0x47, 0x6c, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+	0x20, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x20, 0x41, 0x67, 0x47, 0x6c, 0x46, 0x61,
+	0x75, 0x6c, 0x74, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_mam_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_mam_decoder_initialize(
+     void )
+{
+	libagdb_mam_decoder_t *mam_decoder = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_mam_decoder_initialize(
+	          &mam_decoder,
+	          0,
+	          285,
+	          74,
+	          LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_mam_decoder_initialize(
+	          NULL,
+	          0,
+	          285,
+	          74,
+	          LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_mam_decoder_initialize(
+	          &mam_decoder,
+	          -1,
+	          285,
+	          74,
+	          LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_mam_decoder_initialize(
+	          &mam_decoder,
+	          0,
+	          0,
+	          74,
+	          LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mam_decoder != NULL )
+	{
+		libagdb_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_mam_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_mam_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_mam_decoder_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_mam_decoder_read_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_mam_decoder_read_at_offset(
+     void )
+{
+	uint8_t data[ 74 ];
+
+	libagdb_mam_decoder_t *mam_decoder = NULL;
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_mam_decoder_initialize(
+	          &mam_decoder,
+	          0,
+	          285,
+	          74,
+	          LIBAGDB_MAM_DECODER_WINDOW_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          agdb_test_mam_decoder_compressed_data1,
+	          285,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              0,
+	              data,
+	              74,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 74 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          agdb_test_mam_decoder_uncompressed_data1,
+	          74 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "mam_decoder->decoded_size",
+	 mam_decoder->decoded_size,
+	 (uint64_t) 74 );
+
+	/* Read data that is still in the window
+	 */
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              17,
+	              data,
+	              40,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 40 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( agdb_test_mam_decoder_uncompressed_data1[ 17 ] ),
+	          40 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Data copied from the window is not decoded again
+	 */
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "mam_decoder->decoded_size",
+	 mam_decoder->decoded_size,
+	 (uint64_t) 74 );
+
+	/* Read data after resetting the decoder
+	 */
+	result = libagdb_mam_decoder_reset(
+	          mam_decoder,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              57,
+	              data,
+	              32,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 17 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( agdb_test_mam_decoder_uncompressed_data1[ 57 ] ),
+	          17 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "mam_decoder->decoded_size",
+	 mam_decoder->decoded_size,
+	 (uint64_t) 148 );
+
+	/* Test error cases
+	 */
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              data,
+	              74,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              -1,
+	              data,
+	              74,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              0,
+	              NULL,
+	              74,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( mam_decoder != NULL )
+	{
+		libagdb_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_mam_decoder_restore_checkpoint function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_mam_decoder_restore_checkpoint(
+     void )
+{
+	uint8_t data[ 74 ];
+
+	libagdb_mam_decoder_t *mam_decoder = NULL;
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_mam_decoder_initialize(
+	          &mam_decoder,
+	          0,
+	          285,
+	          74,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          agdb_test_mam_decoder_compressed_data1,
+	          285,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_mam_decoder_restore_checkpoint(
+	          mam_decoder,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_mam_decoder_append_checkpoint(
+	          mam_decoder,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              0,
+	              data,
+	              74,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 74 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_mam_decoder_restore_checkpoint(
+	          mam_decoder,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "mam_decoder->output_offset",
+	 mam_decoder->output_offset,
+	 (size_t) 0 );
+
+	/* The decoder state is closer to the offset than the checkpoint
+	 */
+	result = libagdb_mam_decoder_restore_checkpoint(
+	          mam_decoder,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libagdb_mam_decoder_read_at_offset(
+	              mam_decoder,
+	              file_io_handle,
+	              17,
+	              data,
+	              40,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 40 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( agdb_test_mam_decoder_uncompressed_data1[ 17 ] ),
+	          40 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_mam_decoder_restore_checkpoint(
+	          NULL,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_mam_decoder_free(
+	          &mam_decoder,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "mam_decoder",
+	 mam_decoder );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( mam_decoder != NULL )
+	{
+		libagdb_mam_decoder_free(
+		 &mam_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_mam_decoder_initialize",
+	 agdb_test_mam_decoder_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_mam_decoder_free",
+	 agdb_test_mam_decoder_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_mam_decoder_read_at_offset",
+	 agdb_test_mam_decoder_read_at_offset );
+
+	AGDB_TEST_RUN(
+	 "libagdb_mam_decoder_restore_checkpoint",
+	 agdb_test_mam_decoder_restore_checkpoint );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,544 @@
+/*
+ * Library path_pool type test program
+ *
+ * Copyright (C) 2014-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_path_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_path_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_pool_initialize(
+     void )
+{
+	libagdb_path_pool_t *path_pool = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_pool_initialize(
+	          &path_pool,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_pool",
+	 path_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_pool_free(
+	          &path_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "path_pool",
+	 path_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_pool_initialize(
+	          NULL,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_pool = (libagdb_path_pool_t *) 0x12345678UL;
+
+	result = libagdb_path_pool_initialize(
+	          &path_pool,
+	          64,
+	          &error );
+
+	path_pool = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_pool_initialize(
+	          &path_pool,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_path_pool_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_path_pool_initialize(
+		          &path_pool,
+		          64,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( path_pool != NULL )
+			{
+				libagdb_path_pool_free(
+				 &path_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "path_pool",
+			 path_pool );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_pool != NULL )
+	{
+		libagdb_path_pool_free(
+		 &path_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_path_pool_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_pool_append function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_pool_append(
+     void )
+{
+	uint8_t data[ 96 ];
+
+	libagdb_path_pool_t *path_pool = NULL;
+	libcerror_error_t *error       = NULL;
+	uint8_t *pooled_data1          = NULL;
+	uint8_t *pooled_data2          = NULL;
+	uint8_t *pooled_data3          = NULL;
+	size_t data_index              = 0;
+	int result                     = 0;
+
+	for( data_index = 0;
+	     data_index < 96;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) data_index;
+	}
+	/* Initialize test
+	 */
+	result = libagdb_path_pool_initialize(
+	          &path_pool,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_pool",
+	 path_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          data,
+	          24,
+	          &pooled_data1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pooled_data1",
+	 pooled_data1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          &( data[ 24 ] ),
+	          24,
+	          &pooled_data2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Data that fits in the last block is stored contiguously
+	 */
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "pooled_data2",
+	 (int) ( pooled_data2 == &( pooled_data1[ 24 ] ) ),
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_pool->number_of_blocks",
+	 path_pool->number_of_blocks,
+	 1 );
+
+	/* Data that does not fit in the last block is stored in a new block
+	 */
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          data,
+	          96,
+	          &pooled_data3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_pool->number_of_blocks",
+	 path_pool->number_of_blocks,
+	 2 );
+
+	result = memory_compare(
+	          pooled_data1,
+	          data,
+	          48 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          pooled_data3,
+	          data,
+	          96 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "path_pool->data_size",
+	 (uint64_t) path_pool->data_size,
+	 (uint64_t) 144 );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_pool_append(
+	          NULL,
+	          data,
+	          24,
+	          &pooled_data1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          NULL,
+	          24,
+	          &pooled_data1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          data,
+	          0,
+	          &pooled_data1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_pool_append(
+	          path_pool,
+	          data,
+	          24,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_path_pool_free(
+	          &path_pool,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "path_pool",
+	 path_pool );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_pool != NULL )
+	{
+		libagdb_path_pool_free(
+		 &path_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_pool_initialize",
+	 agdb_test_path_pool_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_pool_free",
+	 agdb_test_path_pool_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_pool_append",
+	 agdb_test_path_pool_append );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
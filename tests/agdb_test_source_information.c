@@ -33,8 +33,18 @@
 #include "agdb_test_memory.h"
 #include "agdb_test_unused.h"
 
+#include "../libagdb/libagdb_io_handle.h"
 #include "../libagdb/libagdb_source_information.h"
 
+uint8_t agdb_test_source_information_data1[ 100 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd4, 0xc3, 0xb2, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4f, 0x54, 0x45,
+	0x50, 0x41, 0x44, 0x2e, 0x45, 0x58, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
 
 /* Tests the libagdb_source_information_initialize function
@@ -274,6 +284,536 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
 
+/* Tests the libagdb_source_information_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_information_read_data(
+     void )
+{
+	libagdb_io_handle_t *io_handle                   = NULL;
+	libagdb_source_information_t *source_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint32_t number_of_entries                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->source_information_entry_size = 100;
+
+	result = libagdb_source_information_initialize(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          io_handle,
+	          agdb_test_source_information_data1,
+	          100,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 ( (libagdb_internal_source_information_t *) source_information )->name_hash,
+	 (uint32_t) 0x78563412UL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 ( (libagdb_internal_source_information_t *) source_information )->prefetch_hash,
+	 (uint32_t) 0xa1b2c3d4UL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetch_hash_is_set",
+	 ( (libagdb_internal_source_information_t *) source_information )->prefetch_hash_is_set,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_information_read_data(
+	          NULL,
+	          io_handle,
+	          agdb_test_source_information_data1,
+	          100,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          NULL,
+	          agdb_test_source_information_data1,
+	          100,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          io_handle,
+	          NULL,
+	          100,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          io_handle,
+	          agdb_test_source_information_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          io_handle,
+	          agdb_test_source_information_data1,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_read_data(
+	          (libagdb_internal_source_information_t *) source_information,
+	          io_handle,
+	          agdb_test_source_information_data1,
+	          100,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_internal_source_information_free(
+	          (libagdb_internal_source_information_t **) &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_information_get_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_information_get_name_hash(
+     void )
+{
+	libagdb_source_information_t *source_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint32_t name_hash                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_source_information_initialize(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libagdb_internal_source_information_t *) source_information )->name_hash = 0x78563412UL;
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_information_get_name_hash(
+	          source_information,
+	          &name_hash,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x78563412UL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_information_get_name_hash(
+	          NULL,
+	          &name_hash,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_get_name_hash(
+	          source_information,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_internal_source_information_free(
+	          (libagdb_internal_source_information_t **) &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_information_get_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_information_get_prefetch_hash(
+     void )
+{
+	libagdb_source_information_t *source_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint32_t prefetch_hash                           = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_source_information_initialize(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_information_get_prefetch_hash(
+	          source_information,
+	          &prefetch_hash,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libagdb_internal_source_information_t *) source_information )->prefetch_hash        = 0xa1b2c3d4UL;
+	( (libagdb_internal_source_information_t *) source_information )->prefetch_hash_is_set = 1;
+
+	result = libagdb_source_information_get_prefetch_hash(
+	          source_information,
+	          &prefetch_hash,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0xa1b2c3d4UL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_information_get_prefetch_hash(
+	          NULL,
+	          &prefetch_hash,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_information_get_prefetch_hash(
+	          source_information,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_internal_source_information_free(
+	          (libagdb_internal_source_information_t **) &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libagdb_source_information_get_utf8_executable_filename_size function
  * Returns 1 if successful or 0 if not
  */
@@ -875,12 +1415,26 @@ int main(
 	 "libagdb_source_information_free",
 	 agdb_test_source_information_free );
 
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_information_read_data",
+	 agdb_test_source_information_read_data );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_information_get_name_hash",
+	 agdb_test_source_information_get_name_hash );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_information_get_prefetch_hash",
+	 agdb_test_source_information_get_prefetch_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
 #if defined( __GNUC__ ) && defined( TODO )
 
 	/* TODO: add tests for libagdb_source_information_read */
 
-	/* TODO: add tests for libagdb_source_information_read_data */
-
 	AGDB_TEST_RUN(
 	 "libagdb_source_information_get_utf8_executable_filename_size",
 	 agdb_test_source_information_get_utf8_executable_filename_size );
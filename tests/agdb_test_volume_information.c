@@ -65,6 +65,21 @@ uint8_t agdb_test_volume_information_data1[ 380 ] = {
 	0x44, 0x00, 0x46, 0x00, 0x2d, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x00, 0x00, 0xc1, 0x29, 0xf7, 0x02,
 	0x81, 0x00, 0x00, 0x00, 0xaa, 0x01, 0x09, 0x01, 0x0f, 0x00, 0x67, 0x06 };
 
+uint16_t agdb_test_volume_information_utf16_path[ 103 ] = {
+	0x005c, 0x0057, 0x0049, 0x004e, 0x0044, 0x004f, 0x0057, 0x0053,
+	0x005c, 0x0057, 0x0049, 0x004e, 0x0053, 0x0058, 0x0053, 0x005c,
+	0x0046, 0x0049, 0x004c, 0x0045, 0x004d, 0x0041, 0x0050, 0x0053,
+	0x005c, 0x0050, 0x0052, 0x004f, 0x0047, 0x0052, 0x0041, 0x004d,
+	0x005f, 0x0046, 0x0049, 0x004c, 0x0045, 0x0053, 0x005f, 0x0043,
+	0x004f, 0x004d, 0x004d, 0x004f, 0x004e, 0x005f, 0x0046, 0x0049,
+	0x004c, 0x0045, 0x0053, 0x005f, 0x004d, 0x0049, 0x0043, 0x0052,
+	0x004f, 0x0053, 0x004f, 0x0046, 0x0054, 0x005f, 0x0053, 0x0048,
+	0x0041, 0x0052, 0x0045, 0x0044, 0x005f, 0x0053, 0x0054, 0x0041,
+	0x0054, 0x0049, 0x004f, 0x004e, 0x0045, 0x0052, 0x0059, 0x005f,
+	0x0033, 0x0046, 0x0036, 0x0043, 0x0032, 0x0031, 0x0045, 0x0042,
+	0x0034, 0x0041, 0x0043, 0x0036, 0x0036, 0x0041, 0x0035, 0x0036,
+	0x002e, 0x0043, 0x0044, 0x0046, 0x002d, 0x004d, 0x0053 };
+
 #if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
 
 /* Reads data from the current offset into a buffer
@@ -653,13 +668,19 @@ on_error:
 int agdb_test_internal_volume_information_read_file_io_handle(
      void )
 {
+	libagdb_file_information_t *file_information     = NULL;
 	libagdb_io_handle_t *io_handle                   = NULL;
 	libagdb_volume_information_t *volume_information = NULL;
 	libbfio_handle_t *file_io_handle                 = NULL;
 	libcerror_error_t *error                         = NULL;
 	libfdata_stream_t *data_stream                   = NULL;
+	const off64_t *path_offsets                      = NULL;
+	const uint32_t *name_hashes                      = NULL;
+	const uint32_t *number_of_entries                = NULL;
+	const uint32_t *path_sizes                       = NULL;
 	ssize64_t read_count                             = 0;
 	int element_index                                = 0;
+	int number_of_files                              = 0;
 	int result                                       = 0;
 
 	/* Initialize test
@@ -787,6 +808,299 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	 "error",
 	 error );
 
+	/* The file information is read on demand, as a new activity that is affected
+	 * by an abort that was signalled before
+	 */
+	io_handle->abort = 1;
+
+	result = libagdb_volume_information_get_file_information(
+	          volume_information,
+	          0,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->abort = 0;
+
+	/* The new activity is not affected by the deadline of a previous activity
+	 */
+	io_handle->deadline = 1;
+
+	result = libagdb_volume_information_get_file_information(
+	          volume_information,
+	          0,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_information = NULL;
+
+	/* The values of the file information records are available in the file table
+	 */
+	result = libagdb_volume_information_get_file_table(
+	          volume_information,
+	          &number_of_files,
+	          &name_hashes,
+	          NULL,
+	          &number_of_entries,
+	          NULL,
+	          &path_offsets,
+	          &path_sizes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hashes",
+	 name_hashes );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "number_of_entries",
+	 number_of_entries );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_offsets",
+	 path_offsets );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_sizes",
+	 path_sizes );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "path_sizes[ 0 ]",
+	 path_sizes[ 0 ],
+	 (uint32_t) 208 );
+
+	result = libagdb_volume_information_get_file_table(
+	          NULL,
+	          &number_of_files,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_file_table(
+	          volume_information,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The file information can be looked up by path, also when the name hash stored
+	 * in the record does not match the hash of the path
+	 */
+	( (libagdb_internal_volume_information_t *) volume_information )->file_table->name_hashes[ 0 ] ^= 0xffffffffUL;
+
+	result = libagdb_volume_information_get_file_information_by_utf8_path(
+	          volume_information,
+	          (uint8_t *) "\\WINDOWS\\WINSXS\\FILEMAPS\\PROGRAM_FILES_COMMON_FILES_MICROSOFT_SHARED_STATIONERY_3F6C21EB4AC66A56.CDF-MS",
+	          103,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_hash_table",
+	 ( (libagdb_internal_volume_information_t *) volume_information )->file_hash_table );
+
+	file_information = NULL;
+
+	result = libagdb_volume_information_get_file_information_by_utf16_path(
+	          volume_information,
+	          agdb_test_volume_information_utf16_path,
+	          103,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_information = NULL;
+
+	result = libagdb_volume_information_get_file_information_by_utf8_path(
+	          volume_information,
+	          (uint8_t *) "\\WINDOWS\\WINSXS\\FILEMAPS",
+	          24,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file_information",
+	 file_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_volume_information_get_file_information_by_utf8_path(
+	          NULL,
+	          (uint8_t *) "\\WINDOWS",
+	          8,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_file_information_by_utf8_path(
+	          volume_information,
+	          NULL,
+	          8,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_file_information_by_utf8_path(
+	          volume_information,
+	          (uint8_t *) "\\WINDOWS",
+	          8,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_file_information_by_utf16_path(
+	          volume_information,
+	          NULL,
+	          8,
+	          &file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Test error cases
 	 */
 	read_count = libagdb_internal_volume_information_read_file_io_handle(
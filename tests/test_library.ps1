@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "compressed_block compressed_blocks_stream_data_handle compressed_file_header error file_information io_handle notify source_information volume_information"
+$LibraryTests = "compressed_block compressed_block_cache compressed_block_pool compressed_block_read_ahead compressed_blocks_stream_data_handle compressed_file_header error file_information file_table hash io_handle mam_decoder notify path_pool record_buffer source_information volume_information"
 $LibraryTestsWithInput = "file support"
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="compressed_block compressed_blocks_stream_data_handle compressed_file_header error file_information io_handle notify source_information volume_information";
+LIBRARY_TESTS="compressed_block compressed_block_cache compressed_block_pool compressed_block_read_ahead compressed_blocks_stream_data_handle compressed_file_header error file_information file_table hash io_handle mam_decoder notify path_pool record_buffer source_information volume_information";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 